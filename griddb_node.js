@@ -1,8 +1,14 @@
 var griddb = require('./griddb_client');
+var stream = require('stream');
 var exports = module.exports;
 
 griddb['StoreFactory_'] = griddb.StoreFactory;
 
+//Number of partitions assigned to each connection in one native call of Store.listContainers
+const LIST_CONTAINERS_BLOCK_PER_WORKER = 8;
+//Number of distinct keys from which Store.multiGet estimates the response size to split the request
+const MULTI_GET_SPLIT_KEY_COUNT = 1000;
+
 /**
  * <p>
  * Manage a Store instance.
@@ -87,6 +93,15 @@ class Store {
     constructor(store) {
         this.store = store;
         this.pController = null;
+        this.containerCache = null;
+        //Batcher of Container.get(), see setGetBatching()
+        this.getBatcher = null;
+        //Queue of put operations, see setAdmissionControl()
+        this.admission = null;
+        //Version of schema changed via this Store, key is lowercase container name
+        this.schemaVersionMap = new Map();
+        //Version of schema when the container was dropped via this Store, key is lowercase container name
+        this.dropVersionMap = new Map();
     }
     
     /**
@@ -133,6 +148,7 @@ class Store {
      * <p>
      * Newly creates or update a Container with the specified ContainerInfo.
      * <br> It can be used only for RowSet obtained with locking enabled.
+     * <br> When modifiable is true, Container instances of the same name got from this Store reload the schema before their next operation.
      * </p>
      * @type {Promise<Container>}
      * @param {ContainerInfo} info - Container information to be processed.
@@ -144,8 +160,15 @@ class Store {
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try{
+                    if (this_.containerCache != null) {
+                        //Schema may be changed
+                        this_.containerCache.invalidate(info.name);
+                    }
+                    if (modifiable) {
+                        this_.changeSchemaVersion(info.name);
+                    }
                     var container = this_.store.putContainer(info, modifiable);
-                    resolve(new Container(container, this_));
+                    resolve(new Container(container, this_, null, info.name));
                 } catch(err) {
                     reject(convertToGSException(err));
                 }
@@ -153,6 +176,42 @@ class Store {
         });
     }
 
+    /**
+     * <p>
+     * Newly creates or update multiple Containers with the specified ContainerInfo list, and creates indexes on each of them.
+     * <br> Containers are processed concurrently by internal connections which have the same properties as this Store. An error of one Container does not stop the others.
+     * <br> Container instances are not returned, use getContainer to access the created Containers.
+     * </p>
+     * @type {Promise<string[]>}
+     * @param {ContainerInfo[]} infos - Container information of each Container.
+     * @param {object} options=null - Options.
+     * @param {number} options.parallelism=1 - Number of connections used concurrently. The upper limit is 32.
+     * @param {object[]} options.indexes=[] - Indexes created on each Container, in the same form as the argument of Container.createIndex.
+     * @param {boolean} options.modifiable=false - Indicates whether the column layout of the existing Container can be modified or not.
+     * @returns {Promise<string[]>} null for each Container which was put with all indexes, or the error message for the others
+     */
+    putContainers(infos, options = null) {
+        var this_ = this;
+        var parallelism = (options == null || options.parallelism === undefined) ? 1 : options.parallelism;
+        var indexes = (options == null || options.indexes === undefined) ? [] : options.indexes;
+        var modifiable = (options != null && options.modifiable === true);
+        if (!Array.isArray(infos)) {
+            return Promise.reject(new Error('Expected array of ContainerInfo'));
+        }
+        return callAsync(function() {
+            for (var info of infos) {
+                if (this_.containerCache != null) {
+                    //Schema may be changed
+                    this_.containerCache.invalidate(info.name);
+                }
+                if (modifiable) {
+                    this_.changeSchemaVersion(info.name);
+                }
+            }
+            return this_.store.putContainers(infos, indexes, modifiable, parallelism);
+        });
+    }
+
     /**
      * <p>
      * Get a Container instance whose Rows can be processed using a Row.
@@ -166,11 +225,21 @@ class Store {
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try {
+                    if (this_.containerCache != null) {
+                        var entry = this_.containerCache.acquire(name);
+                        if (entry != null) {
+                            resolve(new Container(entry.container, this_, entry, name));
+                            return;
+                        }
+                    }
                     var container = this_.store.getContainer(name);
                     if (container === null) {
                         resolve(null);
+                    } else if (this_.containerCache != null) {
+                        var entry = this_.containerCache.add(name, container);
+                        resolve(new Container(container, this_, entry, name));
                     } else {
-                        resolve(new Container(container, this_));
+                        resolve(new Container(container, this_, null, name));
                     }
                 } catch(err) {
                     reject(convertToGSException(err));
@@ -194,6 +263,10 @@ class Store {
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try {
+                    if (this_.containerCache != null) {
+                        this_.containerCache.invalidate(name);
+                    }
+                    this_.changeSchemaVersion(name, true);
                     resolve(this_.store.dropContainer(name));
                 } catch(err) {
                     reject(convertToGSException(err));
@@ -234,6 +307,7 @@ class Store {
      * <br> The commit mode of each Container corresponding to the specified Query can be used in either the auto commit mode or manual commit mode. The transaction status is reflected in the execution results of the query. If the operation is completed normally, the corresponding transaction of each Container will not be aborted so long as the transaction timeout time has not been reached.
      * <br> If an exception occurs in the midst of processing each Query , a new RowSet may be set for only some of the Query . In addition, uncommitted transactions of each Query corresponding to the designated Container may be aborted.
      * <br> If the system tries to acquire a large number of Rows all at once, the upper limit of the communication buffer size managed by the GridDB node may be reached, possibly resulting in a failure. Refer to "System limiting values" in the Appendix of GridDB API Reference for the upper limit size.
+     * <br> Queries whose fetch limit is set by Query.setFetchOptions() are executed by multiple requests if the estimated size of their results exceeds the request size limit. See setRequestSizeLimit().
      * </p>
      * @type {Promise<void>}
      * @param {Query[]} queryList - A list of target Queries
@@ -252,25 +326,109 @@ class Store {
                 }, 0);
             });
         } else {
-            return new Promise(function(resolve, reject) {
-                setTimeout(function() {
-                    var queryListRet = queryList;
-                    var queryListTmp = [];
-                    
-                    for (var i = 0; i < queryListRet.length; i++) {
-                        if (queryListRet[i] && queryListRet[i].hasOwnProperty('query')) {
-                            queryListTmp.push(queryListRet[i].query);
-                        } else {
-                            reject("Invalid input of Store.fetchAll()");
-                        }
-                    }
-                    try {
-                        resolve(this_.store.fetchAll(queryListTmp));
-                    } catch(err) {
-                        reject(convertToGSException(err));
-                    }
-                }, 0);
+            var queryListTmp = [];
+            for (var i = 0; i < queryList.length; i++) {
+                if (queryList[i] && queryList[i].hasOwnProperty('query')) {
+                    queryListTmp.push(queryList[i].query);
+                } else {
+                    return Promise.reject("Invalid input of Store.fetchAll()");
+                }
+            }
+            return callAsync(function() {
+                return splitQueryList(this_.store, queryListTmp);
+            }).then(async function(chunkList) {
+                for (var chunk of chunkList) {
+                    await callAsync(function() {
+                        return this_.store.fetchAll(chunk);
+                    });
+                }
+            });
+        }
+    }
+
+    /**
+     * <p>
+     * Query execution and fetch is carried out on a specified arbitrary number of Query like fetchAll(), and the RowSets are returned group by group.
+     * <br> Queries are grouped by the node which owns the partition of their Container, and each group is requested by one fetchAll.
+     * <br> Groups of Containers in the auto commit mode are executed concurrently by internal connections which have the same properties as this Store, so that a slow node does not delay the others. Each Query is executed again from its TQL statement and fetch options on the internal connection. Their RowSets are returned in the order of completion of groups after all of them complete.
+     * <br> Groups of Containers in the manual commit mode are executed one after another on the connection of this Store when the iteration proceeds, so that each Query is executed in the transaction of its Container.
+     * <br> Queries of a group are requested by multiple fetchAll if the estimated size of their results exceeds the request size limit. See setRequestSizeLimit().
+     * <br> If an exception occurs, the iteration is stopped with the exception and the remaining groups are not executed.
+     * </p>
+     * @type {AsyncIterable<object>}
+     * @param {Query[]} queryList - A list of target Queries
+     * @param {object} options=null - Options.
+     * @param {number} options.parallelism - Number of connections used concurrently. The upper limit is 32. Default is the number of groups.
+     * @returns {AsyncIterable<object>} Objects of {query: Query, rowSet: RowSet} for each group. ex: for await (const {query, rowSet} of store.fetchAllStream(queries))
+     */
+    async *fetchAllStream(queryList, options = null) {
+        var this_ = this;
+        if (queryList == null || queryList.constructor !== Array) {
+            throw(new Error('Invalid input of Store.fetchAllStream()'));
+        }
+        for (var i = 0; i < queryList.length; i++) {
+            if (!queryList[i] || !queryList[i].hasOwnProperty('query')) {
+                throw(new Error('Invalid input of Store.fetchAllStream()'));
+            }
+        }
+        var autoList = [];
+        var transactionList = [];
+        for (var query of queryList) {
+            if (query.container && query.container.autoCommit) {
+                autoList.push(query);
+            } else {
+                transactionList.push(query);
+            }
+        }
+
+        //Chunks of all groups are executed concurrently by one native call
+        var workerChunkList = await callAsync(function() {
+            var chunkList = [];
+            for (var group of groupQueriesByNode(this_, autoList)) {
+                var start = 0;
+                for (var chunk of splitQueryList(this_.store, group.map(query => query.query))) {
+                    chunkList.push(group.slice(start, start + chunk.length));
+                    start += chunk.length;
+                }
+            }
+            return chunkList;
+        });
+        if (workerChunkList.length > 0) {
+            var parallelism = (options == null || options.parallelism === undefined) ? workerChunkList.length : options.parallelism;
+            var result = await callAsync(function() {
+                return this_.store.fetchAllByGroup(workerChunkList.map(chunk => chunk.map(query => query.query)), parallelism);
+            });
+            var startList = [];
+            var start = 0;
+            for (var chunk of workerChunkList) {
+                startList.push(start);
+                start += chunk.length;
+            }
+            for (var index of result.groupOrder) {
+                var chunk = workerChunkList[index];
+                for (var i = 0; i < chunk.length; i++) {
+                    yield {query: chunk[i], rowSet: new RowSet(result.rowSets[startList[index] + i], chunk[i])};
+                }
+            }
+        }
+
+        var groupList = await callAsync(function() {
+            return groupQueriesByNode(this_, transactionList);
+        });
+        for (var group of groupList) {
+            var chunkList = await callAsync(function() {
+                return splitQueryList(this_.store, group.map(query => query.query));
             });
+            var start = 0;
+            for (var chunk of chunkList) {
+                await callAsync(function() {
+                    return this_.store.fetchAll(chunk);
+                });
+                for (var i = start; i < start + chunk.length; i++) {
+                    yield {query: group[i], rowSet: group[i].getRowSet()};
+                }
+                start += chunk.length;
+            }
         }
     }
 
@@ -280,21 +438,66 @@ class Store {
      * <br> For each Row object included in a specified entry column, a new creation or update operation is carried out just like the case when Container.put() is invoked individually. However, unlike the case when carried out individually, the target node is requested for the same storage destination, etc. with a unit that is as large as possible. Based on this, the larger the total number of Row objects specified and the larger the total number of target Containers, the higher is the possibility that the number of correspondences with the target node will be reduced.
      * <br> A specified entry column is composed of an arbitrary number of entries that adopt the Container name as its key and the column of Row objects as its value. A subject Container may be a mixture of different Container types and column layouts. However, the Containers must already exist. Null can not be set as the Container name in the entry column. Also null can not be set as the array address to the column of Row objects if the number of elements in the column of Row objects is positive value.
      * <br> An arbitrary number of Row with the same column layout as the subject Container can be included in each column of Row objects. In the current version, all the column order must also be the same. The Container cannot include null as an element of the column of Row objects. Depending on the Container type and setting, the same restrictions as Container.put() are established for the contents of Rows that can be operated. If there are multiple columns of Row objects having the same Row key targeting the same Container in the designated entry column, the contents of the rear-most Row object having a Row key with the same value will be reflected using the element order of entry column as a reference if it is between different lists, or the element order of the column of Row object as a reference if it is within the same column of Row object. The transaction cannot be maintained and the lock cannot continue to be retained. However, if the lock that affects the target Row is secured by an existing transaction, the system will continue to wait for all the locks to be released. Like other Container or Row operations, consistency between Containers is not guaranteed. Therefore, the processing results for a certain Container may be affected by other operation commands that have been completed prior to the start of the process. If an error occurs in the midst of processing a Container and its Rows, only the results for some of the Rows of some of the Containers may remain reflected.
+     * <br> If options.parallelism is specified, Containers are grouped by the owner node of their partitions and the groups are put concurrently by internal connections which have the same properties as this Store, so that a slow node does not delay the others.
+     * In this case, an error of a group does not reject the returned Promise, the result object has the error message for each Container of the group instead.
+     * <br> Rows exceeding the request size limit are put by multiple requests in order. With options.parallelism, requests of a group are sent while those of other groups are in flight. See setRequestSizeLimit().
      * </p>
-     * @type {Promise<void>}
+     * @type {Promise<void|object.<string, string>>}
      * @param {object.<string, object[][]>} containerEntry - dict-type data consisting of container name and the list of Row objects
-     * @returns {Promise<void>}
+     * @param {object} options=null - Options.
+     * @param {number} options.parallelism - Number of connections used concurrently. The upper limit is 32.
+     * @returns {Promise<void|object.<string, string>>} If options.parallelism is specified, an object which has the same keys as containerEntry and null for Containers whose Rows were put or the error message for the others
      */
-    multiPut(containerEntry) {
+    multiPut(containerEntry, options = null) {
         var this_ = this;
-        return new Promise(function(resolve, reject) {
-            setTimeout(function() {
-                try {
-                    resolve(this_.store.multiPut(containerEntry));
-                } catch(err) {
-                    reject(convertToGSException(err));
+        var rowCount = 0;
+        if (containerEntry != null && typeof containerEntry == 'object') {
+            for (var name of Object.getOwnPropertyNames(containerEntry)) {
+                if (Array.isArray(containerEntry[name])) {
+                    rowCount += containerEntry[name].length;
                 }
-            }, 0);
+            }
+        }
+        return this.callAdmitted(rowCount, function() {
+            if (options == null || options.parallelism === undefined) {
+                return this_.store.multiPut(containerEntry);
+            }
+            var errorList = this_.store.multiPutParallel(containerEntry, options.parallelism);
+            //Native function processes names in the order of own property names
+            var names = Object.getOwnPropertyNames(containerEntry);
+            var result = {};
+            for (var i = 0; i < names.length; i++) {
+                result[names[i]] = errorList[i];
+            }
+            return result;
+        });
+    }
+
+    /**
+     * <p>
+     * Deletes Rows of an arbitrary number of Containers corresponding to the specified Row keys.
+     * <br> A specified entry column is composed of entries that adopt the Container name as its key and the Row keys as its value. Row keys can be an array, or Int32Array for INTEGER Row key and BigInt64Array or Float64Array of integer values for LONG and TIMESTAMP Row key (milliseconds for TIMESTAMP).
+     * <br> Row keys are divided into blocks and the blocks are deleted concurrently by internal connections which have the same properties as this Store. The deletion is not a part of a transaction of any Container.
+     * <br> If an error occurs, the returned Promise is rejected and only some of the Rows may be deleted.
+     * </p>
+     * @type {Promise<object.<string, number>>}
+     * @param {object.<string, any[]|Int32Array|BigInt64Array|Float64Array>} containerEntry - The object of Container name and Row keys
+     * @param {object} options - Options.
+     * @param {number} options.parallelism=1 - Number of connections used concurrently. The upper limit is 32.
+     * @returns {Promise<object.<string, number>>} The number of Rows which existed for each Container name
+     */
+    multiRemove(containerEntry, options = null) {
+        var this_ = this;
+        var parallelism = (options == null || options.parallelism === undefined) ? 1 : options.parallelism;
+        return callAsync(function() {
+            var countList = this_.store.multiRemove(containerEntry, parallelism);
+            //Native function processes names in the order of own property names
+            var names = Object.getOwnPropertyNames(containerEntry);
+            var result = {};
+            for (var i = 0; i < names.length; i++) {
+                result[names[i]] = countList[i];
+            }
+            return result;
         });
     }
 
@@ -307,6 +510,7 @@ class Store {
      * <br> Like other Container or Row operations, consistency between Containers is not guaranteed. Therefore, the processing results for a certain Container may be affected by other operation commands that have been completed prior to the start of the process.
      * <br> Like Container.get() or Query.fetch() , a transaction cannot be maintained and requests for updating locks cannot be made.
      * <br> If the system tries to acquire a large number of Rows all at once, the upper limit of the communication buffer size managed by the GridDB node may be reached, possibly resulting in a failure. Refer to "System limiting values" in the Appendix of GridDB API Reference for the upper limit size.
+     * <br> Conditions with many distinct keys are split into multiple requests if the estimated size of Rows exceeds the request size limit, and the acquired Rows are merged. See setRequestSizeLimit().
      * </p>
      * @type {object.<string, object[]>}
      * @param {object.<string, RowKeyPredicate>} predicateEntry - The column of condition entry consisting of a combination of the target Container name and the acquisition condition. It consists of the array of RowKeyPredicate.
@@ -338,14 +542,25 @@ class Store {
         if (error) {
             return Promise.reject(new Error('Invalid input of multiGet'))
         }
-        return new Promise(function(resolve, reject) {
-            setTimeout(function() {
-                try {
-                    return resolve(this_.store.multiGet(inputPredEntry));
-                } catch(err) {
-                    reject(convertToGSException(err));
-                }
-            }, 0);
+        return callAsync(function() {
+            return splitPredicateEntry(this_.store, inputPredEntry);
+        }).then(async function(chunkList) {
+            if (chunkList.length == 1) {
+                return await callAsync(function() {
+                    return this_.store.multiGet(chunkList[0]);
+                });
+            }
+            var result = {};
+            for (var chunk of chunkList) {
+                var chunkResult = await callAsync(function() {
+                    return this_.store.multiGet(chunk);
+                });
+                Object.keys(chunkResult).forEach(name => {
+                    result[name] = result.hasOwnProperty(name) ?
+                            result[name].concat(chunkResult[name]) : chunkResult[name];
+                });
+            }
+            return result;
         });
     }
 
@@ -367,6 +582,291 @@ class Store {
         }
     }
 
+    /**
+     * <p>
+     * Set time to live of schema cache.
+     * <br> While a cached schema is alive, getContainer and getContainerInfo do not request container information to server.
+     * <br> Cached schema of a container is removed when the container is put or dropped via this Store.
+     * </p>
+     * @type {void}
+     * @param {number} ttl - Time to live in milliseconds. 0 disables schema cache (default).
+     * @returns {void}
+     */
+    setSchemaCacheTtl(ttl) {
+        try {
+            this.store.setSchemaCacheTtl(ttl);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Set upper limit of estimated size of one request for multiPut, multiGet and fetchAll.
+     * <br> Rows and conditions exceeding the limit are sent by multiple requests, so that a request does not reach the upper limit of the communication buffer size managed by the GridDB node.
+     * <br> Size of Rows to be put is estimated from their values, size of Rows to be acquired is estimated from the schema of Container.
+     * </p>
+     * @type {void}
+     * @param {number} limit - Size in bytes. 0 disables splitting. The default is 16MB.
+     * @returns {void}
+     */
+    setRequestSizeLimit(limit) {
+        try {
+            this.store.setRequestSizeLimit(limit);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Get upper limit of estimated size of one request for multiPut, multiGet and fetchAll.
+     * </p>
+     * @type {number}
+     * @returns {number} Size in bytes, 0 if requests are not split
+     */
+    get requestSizeLimit() {
+        return this.store.getRequestSizeLimit();
+    }
+
+    /**
+     * <p>
+     * List names of Containers, optionally only those whose names start with a prefix.
+     * <br> Container names of all partitions are acquired concurrently by internal connections which have the same properties as this Store.
+     * Names are returned each time a block of partitions is acquired, so the first names are available before all partitions are scanned.
+     * </p>
+     * @type {AsyncIterable<string>}
+     * @param {object} options - Options.
+     * @param {string} options.prefix='' - Prefix of Container names. ASCII uppercase and lowercase characters are identified as the same.
+     * @param {number} options.parallelism=4 - Number of connections used concurrently. The upper limit is 32.
+     * @returns {AsyncIterable<string>} Container names. ex: for await (const name of store.listContainers({prefix: 'sensor_'}))
+     */
+    async *listContainers(options = {}) {
+        var this_ = this;
+        var prefix = (options.prefix == null) ? '' : String(options.prefix);
+        var parallelism = (options.parallelism === undefined) ? 4 : options.parallelism;
+        var partitionCount = await callAsync(function() {
+            return this_.partitionController.partitionCount;
+        });
+        var blockSize = parallelism * LIST_CONTAINERS_BLOCK_PER_WORKER;
+        for (var start = 0; start < partitionCount; start += blockSize) {
+            var end = Math.min(start + blockSize, partitionCount);
+            var nameLists = await callAsync(function() {
+                return this_.store.listContainerNames(start, end, prefix, parallelism);
+            });
+            for (var nameList of nameLists) {
+                yield* nameList;
+            }
+        }
+    }
+
+    /**
+     * <p>
+     * Create an in-memory snapshot of Container names which can be refreshed incrementally.
+     * <br> Call ContainerCatalog.refresh() to acquire names.
+     * </p>
+     * @type {ContainerCatalog}
+     * @param {object} options - Options.
+     * @param {string} options.prefix='' - Prefix of Container names. ASCII uppercase and lowercase characters are identified as the same.
+     * @param {number} options.parallelism=4 - Number of connections used concurrently. The upper limit is 32.
+     * @returns {ContainerCatalog} ContainerCatalog instance
+     */
+    createCatalog(options = {}) {
+        var prefix = (options.prefix == null) ? '' : String(options.prefix);
+        var parallelism = (options.parallelism === undefined) ? 4 : options.parallelism;
+        return new ContainerCatalog(this, prefix, parallelism);
+    }
+
+    /**
+     * <p>
+     * Create a writer which collects Rows of arbitrary Containers and puts them by multiPut in batches.
+     * <br> The batch size is adjusted by the measured time of each multiPut toward options.targetLatencyMs, see BatchWriter.
+     * </p>
+     * @type {BatchWriter}
+     * @param {object} options - Options of BatchWriter.
+     * @returns {BatchWriter} BatchWriter instance whose put() takes a Container name and a Row
+     */
+    createBatchWriter(options = {}) {
+        var this_ = this;
+        return new BatchWriter(this, function(items) {
+            var containerEntry = {};
+            for (var [name, row] of items) {
+                if (!Object.prototype.hasOwnProperty.call(containerEntry, name)) {
+                    containerEntry[name] = [];
+                }
+                containerEntry[name].push(row);
+            }
+            this_.store.multiPut(containerEntry);
+        }, options);
+    }
+
+    /**
+     * <p>
+     * Set cache of open Container handles.
+     * <br> While enabled, getContainer returns Container instances which share one native handle for the same container name,
+     * and the handle is kept open after all of them are closed until it is evicted as least recently used.
+     * <br> A shared handle also shares its settings, so setAutoCommit(false) throws an exception for a cached Container. Disable the cache to use the manual commit mode.
+     * </p>
+     * @type {void}
+     * @param {object} options - Cache options. null disables the cache (default).
+     * @param {number} options.maxCount=64 - Max number of cached handles.
+     * @param {number} options.maxBytes=0 - Max estimated memory size of cached handles in bytes, including Rows kept by them for reuse. It is measured again after multiPut() and when a Container is closed. 0 means unlimited.
+     * @returns {void}
+     */
+    setContainerCache(options) {
+        if (this.containerCache != null) {
+            this.containerCache.clear();
+            this.containerCache = null;
+        }
+        if (options == null) {
+            return;
+        }
+        var maxCount = (options.maxCount === undefined) ? 64 : options.maxCount;
+        var maxBytes = (options.maxBytes === undefined) ? 0 : options.maxBytes;
+        if (!Number.isInteger(maxCount) || maxCount <= 0 || !Number.isInteger(maxBytes) || maxBytes < 0) {
+            throw(new Error('Invalid container cache options'));
+        }
+        this.containerCache = new ContainerCache(maxCount, maxBytes);
+    }
+
+    /**
+     * <p>
+     * Set batching of Container.get().
+     * <br> While enabled, Row keys requested by get() of Containers of this Store within one event loop turn, or within options.windowMs, are collected and the Rows are obtained by one multi-get request for each container.
+     * <br> The same Row key requested several times, also via different Container instances of the same container name, is requested only once and each caller receives its own copy of the Row.
+     * <br> It is applied only to Containers in the auto commit mode, since the Rows are not read as a part of the transaction. If the request fails, for example by an invalid Row key, each Row key is requested separately and errors are reported only to its callers.
+     * </p>
+     * @type {void}
+     * @param {object} options - Batching options. null disables batching (default).
+     * @param {number} options.windowMs=0 - Time in milliseconds to wait for other requests. 0 waits until the current event loop turn ends.
+     * @param {number} options.maxBatchSize=1000 - Max number of Row keys in one request.
+     * @returns {void}
+     */
+    setGetBatching(options) {
+        if (options == null) {
+            this.getBatcher = null;
+            return;
+        }
+        var windowMs = (options.windowMs === undefined) ? 0 : options.windowMs;
+        var maxBatchSize = (options.maxBatchSize === undefined) ? MULTI_GET_SPLIT_KEY_COUNT : options.maxBatchSize;
+        if (!Number.isInteger(windowMs) || windowMs < 0 || !Number.isInteger(maxBatchSize) || maxBatchSize <= 0) {
+            throw(new Error('Invalid get batching options'));
+        }
+        this.getBatcher = new GetBatcher(windowMs, maxBatchSize);
+    }
+
+    /**
+     * <p>
+     * Set admission control of put operations.
+     * <br> While enabled, Container.put, Container.multiPut, Store.multiPut and batches of BatchWriter of this Store wait in one bounded queue and are executed one by one in the order of the calls.
+     * <br> If options.rate is specified, the number of Rows put per second is limited by a token bucket which holds up to options.burst Rows. An operation with more Rows than options.burst is executed when the bucket is full.
+     * <br> When the queue is full, options.policy decides the result: 'block' keeps the operation pending until the queue has room, 'reject' rejects it, and 'dropOldest' rejects the oldest operation in the queue to add it.
+     * <br> Container.commit() and Container.abort() also wait in the queue so that they are executed after put operations called before them. They are not rejected nor dropped. Other operations such as Container.get(), Container.remove() and queries are not queued, wait for put operations before calling them if they need to see the Rows.
+     * </p>
+     * @type {void}
+     * @param {object} options - Admission options. null disables admission control (default), operations already queued are still executed.
+     * @param {number} options.maxQueueSize=1000 - Max number of operations in the queue.
+     * @param {string} options.policy='block' - Policy when the queue is full, one of 'block', 'reject' and 'dropOldest'.
+     * @param {number} options.rate=0 - Max number of Rows put per second. 0 means unlimited.
+     * @param {number} options.burst=rate - Max number of Rows put at once after idle time.
+     * @returns {void}
+     */
+    setAdmissionControl(options) {
+        if (options == null) {
+            this.admission = null;
+            return;
+        }
+        var maxQueueSize = (options.maxQueueSize === undefined) ? 1000 : options.maxQueueSize;
+        var policy = (options.policy === undefined) ? 'block' : options.policy;
+        var rate = (options.rate === undefined) ? 0 : options.rate;
+        var burst = (options.burst === undefined) ? Math.max(rate, 1) : options.burst;
+        if (!Number.isInteger(maxQueueSize) || maxQueueSize <= 0 ||
+                (policy != 'block' && policy != 'reject' && policy != 'dropOldest') ||
+                typeof rate != 'number' || !(rate >= 0) || typeof burst != 'number' || !(burst > 0)) {
+            throw(new Error('Invalid admission control options'));
+        }
+        this.admission = new AdmissionController(maxQueueSize, policy, rate, burst);
+    }
+
+    /**
+     * <p>
+     * Get metrics of admission control.
+     * <br> queueDepth is the number of operations in the queue and blockedCount is the number of operations waiting for room of the queue.
+     * waitTime is the time from a call to the start of execution in milliseconds, averageWaitMs is its exponential moving average.
+     * </p>
+     * @type {object}
+     * @returns {{queueDepth: number, blockedCount: number, maxQueueDepth: number, admittedCount: number, rejectedCount: number, droppedCount: number, completedCount: number, lastWaitMs: number, averageWaitMs: number, maxWaitMs: number, tokens: number}} Metrics. null if admission control is disabled.
+     */
+    get admissionMetrics() {
+        if (this.admission == null) {
+            return null;
+        }
+        return this.admission.metrics;
+    }
+
+    /**
+     * Run native put operation of cost Rows asynchronously, through admission control if enabled.
+     * Ordered operation such as commit is executed after operations called before it, and it is not rejected nor dropped.
+     */
+    callAdmitted(cost, func, ordered = false) {
+        if (this.admission == null) {
+            return callAsync(func);
+        }
+        return this.admission.submit(cost, func, ordered);
+    }
+
+    /**
+     * <p>
+     * Remove cached schema, use it when schema is changed by other client.
+     * </p>
+     * @type {void}
+     * @param {string} name=null - Container name. If omitted, all cached schemas are removed.
+     * @returns {void}
+     */
+    invalidateSchemaCache(name = null) {
+        try {
+            if (name == null) {
+                this.store.invalidateSchemaCache();
+            } else {
+                this.store.invalidateSchemaCache(name);
+            }
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * Get version of schema changed via this Store, 0 if it is not changed
+     */
+    getSchemaVersion(key) {
+        var version = this.schemaVersionMap.get(key);
+        return (version === undefined) ? 0 : version;
+    }
+
+    /**
+     * Get version of schema when the container was dropped via this Store, 0 if it is not dropped
+     */
+    getDropVersion(key) {
+        var version = this.dropVersionMap.get(key);
+        return (version === undefined) ? 0 : version;
+    }
+
+    /**
+     * Mark schema of a container as changed so that Container instances of the name reload it.
+     * Handles of a dropped container are reopened, the others are reopened only if the schema is changed.
+     */
+    changeSchemaVersion(name, dropped = false) {
+        if (name == null) {
+            return;
+        }
+        var key = String(name).toLowerCase();
+        var version = this.getSchemaVersion(key) + 1;
+        this.schemaVersionMap.set(key, version);
+        if (dropped) {
+            this.dropVersionMap.set(key, version);
+        }
+    }
+
     /**
      * <p>
      * Disconnects with GridDB and releases related resources as necessary.
@@ -380,6 +880,7 @@ class Store {
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try {
+                    this_.setContainerCache(null);
                     resolve(this_.store.close(false));
                 } catch(err) {
                     reject(convertToGSException(err));
@@ -398,6 +899,7 @@ class Store {
      */
     closeSync() {
         try {
+            this.setContainerCache(null);
             this.store.close(false);
         } catch(err) {
             throw(convertToGSException(err));
@@ -450,10 +952,21 @@ class Store {
  * @property {ContainerType} type=0 - Container type
  */
 class Container {
-    constructor(container, store) {
+    constructor(container, store, cacheEntry = null, name = null) {
         this.container = container;
         //need reference to avoid gc
         this.store = store;
+        //Entry of Store.containerCache when native container is shared
+        this.cacheEntry = cacheEntry;
+        //Set when this Container released the shared native container, it must not be closed by this Container
+        this.released = false;
+        //Lowercase container name and version of schema loaded, see Store.changeSchemaVersion()
+        this.schemaKey = (name == null) ? null : String(name).toLowerCase();
+        this.schemaVersion = (this.schemaKey == null) ? 0 : store.getSchemaVersion(this.schemaKey);
+        //Commit mode set by setAutoCommit()
+        this.autoCommit = true;
+        //Buffer of Rows put in the manual commit mode, see setGroupCommit()
+        this.groupCommit = null;
     }
 
     /**
@@ -492,6 +1005,34 @@ class Container {
         return this.container.timestampOutput;
     }
 
+    /**
+     * <p>
+     * Set max number of native rows kept for reuse by multiPut.
+     * <br> The default is 256. 0 disables reuse, rows are created and released for each multiPut.
+     * <br> Rows holding STRING, BLOB, GEOMETRY or array values larger than about 4KB in total are released instead of being kept, so that the pool does not keep large values.
+     * </p>
+     * @type {void}
+     * @param {number} value - Max number of rows
+     */
+    set rowPoolSize(value) {
+        try {
+            this.container.setRowPoolSize(value);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Get max number of native rows kept for reuse by multiPut.
+     * </p>
+     * @type {number}
+     * @returns {number} Max number of rows
+     */
+    get rowPoolSize() {
+        return this.container.getRowPoolSize();
+    }
+
     /**
      * <p>
      * Creates a query to execute the specified TQL statement.
@@ -502,18 +1043,39 @@ class Container {
      */
     query(strQuery) {
         try {
+            this.flushGroupCommit();
             return new Query(this.container.query(strQuery), this);
         } catch(err) {
             throw(convertToGSException(err));
         }
     }
 
+    /**
+     * <p>
+     * Creates a reusable query from the specified TQL statement with parameters.
+     * <br> "?1", "?2", ... in the statement are replaced with the values bound by PreparedQuery.execute().
+     * "?" in a string literal or a quoted name is not a parameter.
+     * </p>
+     * @type {PreparedQuery}
+     * @param {string} query - TQL statement. ex: "select * where ts > ?1 and ts < ?2"
+     * @returns {PreparedQuery} PreparedQuery instance
+     */
+    prepare(strQuery) {
+        try {
+            this.flushGroupCommit();
+            return new PreparedQuery(this.container.prepare(strQuery), this);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
     /**
      * <p>
      * Newly creates or update a Row.
      * <br>If a Column exists which corresponds to the specified Row key, it determines whether to newly create or update a Row, based on the Row key and the state of the Container. If there is no corresponding Row in the Container, it determines to newly create a Row; otherwise, it updates a relevant Row.
      * <br>If no Column exists which corresponds to the specified Row key, it always creates a new Row.
      * <br>In the manual commit mode, the target Row is locked.
+     * <br>If group commit is enabled by setGroupCommit() in the manual commit mode, the Row is buffered and null is returned since it is not known whether the Row exists.
      * </p>
      * @type {Promise<boolean>}
      * @param {object[]} row=null - A list object representing the content of a Row to be newly created or updated.
@@ -521,20 +1083,20 @@ class Container {
      */
     put(arr) {
         var this_ = this;
-        return new Promise(function(resolve, reject) {
-            setTimeout(function() {
-                try {
-                    resolve(this_.container.put(arr));
-                } catch(err) {
-                    reject(convertToGSException(err));
-                }
-            }, 0);
+        if (this.groupCommit != null && !this.autoCommit) {
+            return this.groupCommit.add(arr);
+        }
+        return this.store.callAdmitted(1, function() {
+            return this_.callWithSchemaCheck(function() {
+                return this_.container.put(arr);
+            });
         });
     }
 
     /**
      * <p>
      * Returns the content of a Row corresponding to Row key.
+     * <br> If batching is enabled by Store.setGetBatching(), the Row may be obtained together with other Rows by one request.
      * </p>
      * @type {Promise<object[]>}
      * @param {object} key - Row key to be processed
@@ -543,10 +1105,15 @@ class Container {
      */
     get(key) {
         var this_ = this;
+        if (this.store.getBatcher != null && this.schemaKey != null && this.autoCommit) {
+            return this.store.getBatcher.load(this, key);
+        }
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try {
-                    var row = this_.container.get(key);
+                    var row = this_.callWithSchemaCheck(function() {
+                        return this_.container.get(key);
+                    });
                     resolve(row);
                 } catch(err) {
                     reject(convertToGSException(err));
@@ -569,7 +1136,9 @@ class Container {
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try{
-                    resolve(this_.container.remove(key));
+                    resolve(this_.callWithSchemaCheck(function() {
+                        return this_.container.remove(key);
+                    }));
                 } catch(err) {
                     reject(convertToGSException(err));
                 }
@@ -577,6 +1146,86 @@ class Container {
         });
     }
 
+    /**
+     * <p>
+     * Deletes the Rows corresponding to the specified Row keys.
+     * <br> Row keys can be an array, or Int32Array for INTEGER Row key and BigInt64Array or Float64Array of integer values for LONG and TIMESTAMP Row key (milliseconds for TIMESTAMP). Typed arrays are converted without creating a value for each key.
+     * <br> Rows are deleted in the same way as remove() is invoked for each key. In the manual commit mode, the target Rows are locked.
+     * <br> If options.parallelism is specified, Row keys are deleted concurrently by internal connections which have the same properties as the Store. It is available only in the auto commit mode, since the deletion is not a part of the transaction of this Container.
+     * </p>
+     * @type {Promise<number>}
+     * @param {any[]|Int32Array|BigInt64Array|Float64Array} keys - Row keys
+     * @param {object} options - Options.
+     * @param {number} options.parallelism - Number of connections used concurrently. The upper limit is 32.
+     * @returns {Promise<number>} The number of Rows which existed
+     */
+    multiRemove(keys, options = null) {
+        var this_ = this;
+        if (options != null && options.parallelism !== undefined) {
+            if (!this.autoCommit) {
+                return Promise.reject(new Error('options.parallelism is available only in auto commit mode'));
+            }
+            if (this.schemaKey == null) {
+                return Promise.reject(new Error('Container name is unknown'));
+            }
+            var entry = {};
+            entry[this.schemaKey] = keys;
+            return this.store.multiRemove(entry, options).then(function(result) {
+                return result[this_.schemaKey];
+            });
+        }
+        return callAsync(function() {
+            //Rows removed before a failure would not be counted by a retry
+            return this_.callWithSchemaCheck(function() {
+                return this_.container.multiRemove(keys);
+            }, false);
+        });
+    }
+
+    /**
+     * <p>
+     * Returns the Rows corresponding to the specified Row keys by one request.
+     * <br> Row keys can be an array or a typed array in the same way as multiRemove(). Rows which do not exist are not included in the result.
+     * <br> Keys of the returned Map are Row key values, TIMESTAMP Row keys are epoch milliseconds.
+     * <br> If options.columnar is true, Rows are returned by column in the same form as RowSet.fetchColumns(), and index maps each Row key to the position of the Row.
+     * <br> In the manual commit mode, Rows are acquired one by one in the transaction of this Container, so that its uncommitted updates are included.
+     * <br> If the system tries to acquire a large number of Rows all at once, the upper limit of the communication buffer size managed by the GridDB node may be reached, possibly resulting in a failure.
+     * </p>
+     * @type {Promise<Map<any, object[]>>|Promise<object>}
+     * @param {any[]|Int32Array|BigInt64Array|Float64Array} keys - Row keys
+     * @param {object} options - Options.
+     * @param {boolean} options.columnar=false - Return values by column.
+     * @returns {Promise<Map<any, object[]>>|Promise<{rowCount: number, types: Type[], columns: Array[], index: Map<any, number>}>} Rows for each Row key, or values by column
+     */
+    getMany(keys, options = null) {
+        var this_ = this;
+        var columnar = (options != null && options.columnar === true);
+        return callAsync(function() {
+            return this_.callWithSchemaCheck(function() {
+                if (!columnar) {
+                    var rowMap = new Map();
+                    for (var row of this_.container.getMany(keys)) {
+                        rowMap.set((row[0] instanceof Date) ? row[0].getTime() : row[0], row);
+                    }
+                    return rowMap;
+                }
+                var result = this_.container.getManyColumns(keys);
+                result.index = new Map();
+                for (var i = 0; i < result.rowCount; i++) {
+                    result.index.set(result.columns[0][i], i);
+                }
+                if (!this_.timestampOutput) {
+                    for (var i = 0; i < result.types.length; i++) {
+                        if (result.types[i] == griddb.Type.TIMESTAMP) {
+                            result.columns[i] = new TimestampColumn(result.columns[i]);
+                        }
+                    }
+                }
+                return result;
+            });
+        });
+    }
+
     /**
      * <p>
      * Creates a specified type of index on the specified Column.
@@ -662,31 +1311,267 @@ class Container {
      * @returns {Promise<void>}
      */
     abort() {
+        var this_ = this;
+        if (this.groupCommit != null) {
+            return this.groupCommit.abort();
+        }
+        //Executed after put operations waiting for admission
+        return this.store.callAdmitted(0, function() {
+            return this_.container.abort();
+        }, true);
+    }
+
+    /**
+     * <p>
+     * Commits the result of the current transaction and start a new transaction in the manual commit mode.
+     * </p>
+     * @type {Promise<void>}
+     * @returns {Promise<void>}
+     */
+    commit() {
+        var this_ = this;
+        if (this.groupCommit != null) {
+            return this.groupCommit.commit();
+        }
+        //Executed after put operations waiting for admission
+        return this.store.callAdmitted(0, function() {
+            return this_.container.commit();
+        }, true);
+    }
+
+    /**
+     * <p>
+     * Change the setting of the commit mode.
+     * <br> In the auto commit mode, the transaction state cannot be controlled directly and change operations are committed sequentially. If the auto commit mode is disabled, i.e. in the manual commit mode, as long as the transaction has not timed out or commit() has been invoked directly, the same transaction will continue to be used in this Container and change operations will not be committed.
+     * <br> When the auto commit mode is switched from disabled to enabled, uncommitted updates are committed implicitly. Unless the commit mode is changed, the state of the transaction will not be changed.
+     * <br> The manual commit mode is not available for a Container sharing its handle by the cache of Store, see Store.setContainerCache().
+     * </p>
+     * @type {void}
+     * @param {boolean} enabled - Indicates whether it enables auto commit mode or not. if True, auto commit mode is enabled. if False, manual commit mode is enabled.
+     */
+    setAutoCommit(commitFlg) {
+        if (!commitFlg && this.cacheEntry != null) {
+            throw(new Error('Manual commit mode is not available for a cached Container'));
+        }
+        try {
+            //Buffered Rows are committed implicitly together with other updates
+            this.flushGroupCommit();
+            this.container.setAutoCommit(commitFlg);
+            this.autoCommit = Boolean(commitFlg);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Set group commit mode.
+     * <br> While enabled in the manual commit mode, Rows of put() are buffered and put by one multiPut in the current transaction when options.maxBufferSize Rows are buffered, or before commit() and the other operations of this Container.
+     * <br> If options.commitWindowMs is specified, commit() calls within the time are merged into one commit, and all of them are resolved or rejected by its result.
+     * <br> If putting buffered Rows fails, the transaction is aborted by the next commit() which is rejected with the error.
+     * <br> Buffered Rows are put without admission control of the Store, but commit() and abort() wait for put operations queued by it before them, see Store.setAdmissionControl().
+     * </p>
+     * @type {void}
+     * @param {object} options - Group commit options. null disables group commit (default) after putting buffered Rows.
+     * @param {number} options.maxBufferSize=1000 - Max number of buffered Rows.
+     * @param {number} options.commitWindowMs=0 - Time in milliseconds to wait for other commit() calls. 0 commits without waiting.
+     * @returns {void}
+     */
+    setGroupCommit(options) {
+        if (options == null) {
+            try {
+                this.flushGroupCommit();
+            } catch(err) {
+                throw(convertToGSException(err));
+            }
+            this.groupCommit = null;
+            return;
+        }
+        var maxBufferSize = (options.maxBufferSize === undefined) ? 1000 : options.maxBufferSize;
+        var commitWindowMs = (options.commitWindowMs === undefined) ? 0 : options.commitWindowMs;
+        if (!Number.isInteger(maxBufferSize) || maxBufferSize <= 0 || !Number.isInteger(commitWindowMs) || commitWindowMs < 0) {
+            throw(new Error('Invalid group commit options'));
+        }
+        if (this.groupCommit != null) {
+            this.groupCommit.maxBufferSize = maxBufferSize;
+            this.groupCommit.commitWindowMs = commitWindowMs;
+            return;
+        }
+        this.groupCommit = new GroupCommitBuffer(this, maxBufferSize, commitWindowMs);
+    }
+
+    /**
+     * Put buffered Rows of group commit, it is called before other operations so that they see the Rows
+     */
+    flushGroupCommit() {
+        if (this.groupCommit != null) {
+            this.groupCommit.flush();
+        }
+    }
+
+    /**
+     * <p>
+     * Create a writer which collects Rows of this Container and puts them by multiPut in batches.
+     * <br> The batch size is adjusted by the measured time of each multiPut toward options.targetLatencyMs, see BatchWriter.
+     * </p>
+     * @type {BatchWriter}
+     * @param {object} options - Options of BatchWriter.
+     * @returns {BatchWriter} BatchWriter instance whose put() takes a Row
+     */
+    createBatchWriter(options = {}) {
+        var this_ = this;
+        return new BatchWriter(this.store, function(items) {
+            this_.callWithSchemaCheck(function() {
+                return this_.container.multiPut(items.map(function(item) { return item[1]; }));
+            });
+        }, options);
+    }
+
+    /**
+     * <p>
+     * Newly creates an arbitrary number of Rows together based on the specified Row objects group.
+     * <br> In the manual commit mode, the target Row is locked.
+     * </p>
+     * @type {Promise<void>}
+     * @param {object[][]} rowList - List object corresponding to contents of newly created Row collection
+     * @returns {Promise<void>}
+     */
+    multiPut(rowList) {
+        var this_ = this;
+        return this.store.callAdmitted(Array.isArray(rowList) ? rowList.length : 0, function() {
+            var result = this_.callWithSchemaCheck(function() {
+                return this_.container.multiPut(rowList);
+            });
+            if (this_.cacheEntry != null) {
+                this_.cacheEntry.cache.update(this_.cacheEntry);
+            }
+            return result;
+        });
+    }
+
+    /**
+     * <p>
+     * Puts a BLOB value read from a stream to the specified Column of a Row corresponding to Row key.
+     * <br> Chunks are accumulated in native memory, the whole value is not held as one Buffer in JavaScript.
+     * <br> Other Columns keep current values. If there is no corresponding Row, a Row is newly created with default values.
+     * <br> In the manual commit mode, the target Row is locked when its current values are read. In the auto commit mode, the Row is read and put by separate requests, so an update of other Columns between them is overwritten.
+     * </p>
+     * @type {Promise<boolean>}
+     * @param {object} key - Row key to be processed
+     * @param {number} column - Index of BLOB Column
+     * @param {stream.Readable} readable - Stream of BLOB value
+     * @param {number} expectedSize=0 - Expected size of BLOB value used to reserve memory at once. 0 if unknown.
+     * @returns {Promise<boolean>} True if a Row exists
+     */
+    putBlobStream(key, column, readable, expectedSize = 0) {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            var writer;
+            try {
+                writer = this_.container.createBlobWriter(column, expectedSize);
+            } catch(err) {
+                reject(convertToGSException(err));
+                return;
+            }
+            readable.on('data', function(chunk) {
+                try {
+                    writer.append(Buffer.isBuffer(chunk) ? chunk : Buffer.from(chunk));
+                } catch(err) {
+                    readable.destroy();
+                    writer.clear();
+                    reject(convertToGSException(err));
+                }
+            });
+            readable.on('error', function(err) {
+                writer.clear();
+                reject(err);
+            });
+            readable.on('end', function() {
+                setTimeout(function() {
+                    try {
+                        resolve(this_.container.putBlob(key, writer));
+                    } catch(err) {
+                        reject(convertToGSException(err));
+                    } finally {
+                        writer.clear();
+                    }
+                }, 0);
+            });
+        });
+    }
+
+    /**
+     * <p>
+     * Returns a stream which reads a BLOB value of the specified Column of a Row corresponding to Row key.
+     * <br> The value is kept in native memory and copied to JavaScript chunk by chunk.
+     * <br> NULL value is read as empty stream.
+     * </p>
+     * @type {Promise<stream.Readable>}
+     * @param {object} key - Row key to be processed
+     * @param {number} column - Index of BLOB Column
+     * @param {number} chunkSize=1048576 - Max size of each chunk
+     * @returns {Promise<stream.Readable>} Stream of BLOB value. If there is no corresponding Row, null is returned.
+     */
+    getBlobStream(key, column, chunkSize = 1048576) {
         var this_ = this;
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
+                var reader;
                 try {
-                    resolve(this_.container.abort());
+                    reader = this_.container.getBlobReader(key, column);
                 } catch(err) {
                     reject(convertToGSException(err));
+                    return;
+                }
+                if (reader == null) {
+                    resolve(null);
+                    return;
                 }
+                var blobStream = new stream.Readable({
+                    read() {
+                        try {
+                            var chunk = reader.read(chunkSize);
+                            if (chunk == null) {
+                                reader.close();
+                            }
+                            this.push(chunk);
+                        } catch(err) {
+                            this.destroy(convertToGSException(err));
+                        }
+                    },
+                    destroy(err, callback) {
+                        reader.close();
+                        callback(err);
+                    }
+                });
+                //need reference to avoid gc
+                blobStream.container = this_;
+                resolve(blobStream);
             }, 0);
         });
     }
 
     /**
      * <p>
-     * Commits the result of the current transaction and start a new transaction in the manual commit mode.
+     * Disconnects with GridDB and releases related resources as necessary.
      * </p>
      * @type {Promise<void>}
      * @returns {Promise<void>}
      */
-    commit() {
+    close() {
         var this_ = this;
         return new Promise(function(resolve, reject) {
             setTimeout(function() {
                 try {
-                    resolve(this_.container.commit());
+                    if (this_.cacheEntry != null) {
+                        resolve(this_.releaseCacheEntry());
+                        return;
+                    }
+                    if (this_.released) {
+                        resolve();
+                        return;
+                    }
+                    resolve(this_.container.close());
                 } catch(err) {
                     reject(convertToGSException(err));
                 }
@@ -696,76 +1581,941 @@ class Container {
 
     /**
      * <p>
-     * Change the setting of the commit mode.
-     * <br> In the auto commit mode, the transaction state cannot be controlled directly and change operations are committed sequentially. If the auto commit mode is disabled, i.e. in the manual commit mode, as long as the transaction has not timed out or commit() has been invoked directly, the same transaction will continue to be used in this Container and change operations will not be committed.
-     * <br> When the auto commit mode is switched from disabled to enabled, uncommitted updates are committed implicitly. Unless the commit mode is changed, the state of the transaction will not be changed.
+     * Disconnects with GridDB and releases related resources as necessary.
+     * </p>
+     * @type {void}
+     * @returns {void}
+     */
+    closeSync() {
+        try {
+            if (this.cacheEntry != null) {
+                this.releaseCacheEntry();
+                return;
+            }
+            if (this.released) {
+                return;
+            }
+            this.container.close();
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Reload the schema of this Container from GridDB.
+     * <br> If the schema was changed by other clients, the native handle is reopened with the new schema.
+     * put, get, remove and multiPut do it automatically and retry once when they fail in the auto commit mode, so call it only to apply the change in advance.
+     * <br> In the manual commit mode they do not, since the transaction can not be continued by a new handle. If the handle is reopened by this method in the manual commit mode, the current transaction is aborted.
+     * </p>
+     * @type {Promise<boolean>}
+     * @returns {Promise<boolean>} True if the schema was changed and the handle was reopened
+     */
+    refreshSchema() {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            setTimeout(function() {
+                try {
+                    resolve(this_.reloadSchema());
+                } catch(err) {
+                    reject(convertToGSException(err));
+                }
+            }, 0);
+        });
+    }
+
+    /**
+     * Reload schema by native Store, the handle is reopened if the container was dropped via the Store or the schema was changed
+     */
+    reloadSchema() {
+        var version = (this.schemaKey == null) ? 0 : this.store.getSchemaVersion(this.schemaKey);
+        var force = (this.schemaKey != null && this.store.getDropVersion(this.schemaKey) > this.schemaVersion);
+        var reopened = this.store.store.refreshContainer(this.container, force);
+        this.schemaVersion = version;
+        return reopened;
+    }
+
+    /**
+     * Run native operation. The handle is reopened before it if the schema was changed via the Store,
+     * and the operation is retried once if it fails and the schema was changed on server.
+     * In the manual commit mode, the handle is not reopened since the transaction can not be continued by a new handle.
+     * The operation is not retried if retry is false, for example when it may partially succeed.
+     */
+    callWithSchemaCheck(func, retry = true) {
+        this.flushGroupCommit();
+        var changed = (this.schemaKey != null && this.store.getSchemaVersion(this.schemaKey) !== this.schemaVersion);
+        if (!this.autoCommit) {
+            if (changed && this.store.getDropVersion(this.schemaKey) > this.schemaVersion) {
+                throw(new Error('Container was dropped via Store during the transaction. Abort it and call refreshSchema()'));
+            }
+            try {
+                return func();
+            } catch(err) {
+                if (changed) {
+                    throw(new Error('Schema of Container may be changed via Store during the transaction. Abort it and call refreshSchema(): ' + err.message));
+                }
+                throw err;
+            }
+        }
+        if (changed) {
+            this.reloadSchema();
+        }
+        return retry ? this.callWithRetry(func) : func();
+    }
+
+    /**
+     * Run native operation, it is retried once if it fails and the schema was changed on server
+     */
+    callWithRetry(func) {
+        try {
+            return func();
+        } catch(err) {
+            var reopened = false;
+            try {
+                reopened = this.reloadSchema();
+            } catch(refreshErr) {
+                //Report the original error
+            }
+            if (!reopened) {
+                throw err;
+            }
+        }
+        return func();
+    }
+
+    /**
+     * Release shared native container, it is closed when no Container uses it and it was evicted from cache
+     */
+    releaseCacheEntry() {
+        var entry = this.cacheEntry;
+        this.cacheEntry = null;
+        this.released = true;
+        entry.cache.release(entry);
+    }
+};
+
+/**
+ * <p>
+ * In-memory snapshot of Container names created by Store.createCatalog().
+ * <br> refresh() compares the number of Containers of each partition with the last snapshot and acquires names only for partitions whose number is changed.
+ * A partition where Containers are dropped and created in the same number is not detected, use refresh(true) to acquire all names.
+ * </p>
+ * @alias ContainerCatalog
+ * @type {object}
+ */
+class ContainerCatalog {
+    constructor(store, prefix, parallelism) {
+        //need reference to avoid gc
+        this.store = store;
+        this.prefix = prefix;
+        this.parallelism = parallelism;
+        this.partitionNames = null;
+        this.partitionCounts = null;
+        this.nameSet = null;
+    }
+
+    /**
+     * <p>
+     * Update the snapshot.
+     * </p>
+     * @type {Promise<number>}
+     * @param {boolean} full=false - Acquire names of all partitions.
+     * @returns {Promise<number>} Number of partitions whose names were acquired
+     */
+    refresh(full = false) {
+        var this_ = this;
+        return callAsync(function() {
+            var nativeStore = this_.store.store;
+            var partitionCount = this_.store.partitionController.partitionCount;
+            var counts = nativeStore.getContainerCounts(0, partitionCount, this_.parallelism);
+            if (this_.partitionNames == null || this_.partitionNames.length != partitionCount) {
+                this_.partitionNames = new Array(partitionCount).fill(null);
+                full = true;
+            }
+            var refreshed = 0;
+            var start = 0;
+            while (start < partitionCount) {
+                if (!full && this_.partitionCounts[start] == counts[start]) {
+                    start++;
+                    continue;
+                }
+                //Acquire names of contiguous changed partitions at once
+                var end = start + 1;
+                while (end < partitionCount && (full || this_.partitionCounts[end] != counts[end])) {
+                    end++;
+                }
+                var nameLists = nativeStore.listContainerNames(start, end, this_.prefix, this_.parallelism);
+                for (var i = 0; i < nameLists.length; i++) {
+                    this_.partitionNames[start + i] = nameLists[i];
+                }
+                refreshed += end - start;
+                start = end;
+            }
+            this_.partitionCounts = counts;
+            if (refreshed > 0) {
+                this_.nameSet = null;
+            }
+            return refreshed;
+        });
+    }
+
+    /**
+     * <p>
+     * Get the number of Container names in the snapshot.
+     * </p>
+     * @type {number}
+     * @returns {number} Number of names
+     */
+    get size() {
+        if (this.partitionNames == null) {
+            return 0;
+        }
+        return this.partitionNames.reduce(function(sum, x) { return sum + x.length; }, 0);
+    }
+
+    /**
+     * <p>
+     * Get Container names in the snapshot.
+     * </p>
+     * @type {string[]}
+     * @returns {string[]} Container names
+     */
+    names() {
+        if (this.partitionNames == null) {
+            return [];
+        }
+        return [].concat.apply([], this.partitionNames);
+    }
+
+    /**
+     * <p>
+     * Check the snapshot contains the Container name. ASCII uppercase and lowercase characters are identified as the same.
+     * </p>
+     * @type {boolean}
+     * @param {string} name - Container name
+     * @returns {boolean} Whether the snapshot contains the name
+     */
+    has(name) {
+        if (this.nameSet == null) {
+            this.nameSet = new Set(this.names().map(function(x) { return x.toLowerCase(); }));
+        }
+        return this.nameSet.has(String(name).toLowerCase());
+    }
+};
+
+/**
+ * LRU cache of open native containers shared by Container instances of a Store.
+ * Container name is case insensitive, so key is lowercase container name.
+ */
+class ContainerCache {
+    constructor(maxCount, maxBytes) {
+        this.maxCount = maxCount;
+        this.maxBytes = maxBytes;
+        this.bytes = 0;
+        //Map keeps insertion order, the first entry is the least recently used
+        this.entries = new Map();
+    }
+
+    acquire(name) {
+        var key = String(name).toLowerCase();
+        var entry = this.entries.get(key);
+        if (entry === undefined) {
+            return null;
+        }
+        this.entries.delete(key);
+        this.entries.set(key, entry);
+        entry.refCount++;
+        return entry;
+    }
+
+    add(name, container) {
+        this.invalidate(name);
+        var entry = {
+            cache: this,
+            key: String(name).toLowerCase(),
+            container: container,
+            bytes: container.getMemorySize(),
+            refCount: 1,
+            evicted: false
+        };
+        this.entries.set(entry.key, entry);
+        this.bytes += entry.bytes;
+        this.trim();
+        return entry;
+    }
+
+    //Measure the size again since rows kept for reuse grow by multiPut
+    update(entry) {
+        if (entry.evicted) {
+            return;
+        }
+        var bytes = entry.container.getMemorySize();
+        this.bytes += bytes - entry.bytes;
+        entry.bytes = bytes;
+        this.trim();
+    }
+
+    trim() {
+        for (var oldest of this.entries.values()) {
+            if (this.entries.size <= this.maxCount && (this.maxBytes == 0 || this.bytes <= this.maxBytes)) {
+                break;
+            }
+            this.remove(oldest);
+        }
+    }
+
+    release(entry) {
+        this.update(entry);
+        entry.refCount--;
+        if (entry.refCount == 0 && entry.evicted) {
+            entry.container.close();
+        }
+    }
+
+    invalidate(name) {
+        var entry = this.entries.get(String(name).toLowerCase());
+        if (entry !== undefined) {
+            this.remove(entry);
+        }
+    }
+
+    //Entries in use are closed when the last Container is closed
+    remove(entry) {
+        this.entries.delete(entry.key);
+        this.bytes -= entry.bytes;
+        entry.evicted = true;
+        if (entry.refCount == 0) {
+            entry.container.close();
+        }
+    }
+
+    clear() {
+        for (var entry of Array.from(this.entries.values())) {
+            this.remove(entry);
+        }
+    }
+};
+
+/**
+ * Collect Row keys requested by Container.get() and obtain them by one multi-get request for each container.
+ * Requests are grouped by lowercase container name and timestamp output type,
+ * and identical Row keys in a group share one result.
+ */
+class GetBatcher {
+    constructor(windowMs, maxBatchSize) {
+        this.windowMs = windowMs;
+        this.maxBatchSize = maxBatchSize;
+        //Map of group key to {container, keyMap}, keyMap maps normalized Row key to {key, waiters}
+        this.groups = new Map();
+        this.scheduled = false;
+    }
+
+    load(container, key) {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            var groupKey = container.schemaKey + (container.timestampOutput ? '\u0000t' : '\u0000d');
+            var group = this_.groups.get(groupKey);
+            if (group === undefined) {
+                group = {container: container, keyMap: new Map()};
+                this_.groups.set(groupKey, group);
+            }
+            //Use the latest Container, the former ones may be closed before the request
+            group.container = container;
+            var normalizedKey = (key instanceof Date) ? key.getTime() : key;
+            var entry = group.keyMap.get(normalizedKey);
+            if (entry === undefined) {
+                entry = {key: key, waiters: []};
+                group.keyMap.set(normalizedKey, entry);
+            }
+            entry.waiters.push({resolve: resolve, reject: reject});
+            this_.schedule();
+        });
+    }
+
+    schedule() {
+        if (this.scheduled) {
+            return;
+        }
+        this.scheduled = true;
+        var this_ = this;
+        var dispatch = function() {
+            this_.scheduled = false;
+            var groups = this_.groups;
+            this_.groups = new Map();
+            for (var group of groups.values()) {
+                this_.dispatch(group);
+            }
+        };
+        if (this.windowMs == 0) {
+            setImmediate(dispatch);
+        } else {
+            setTimeout(dispatch, this.windowMs);
+        }
+    }
+
+    dispatch(group) {
+        var entries = Array.from(group.keyMap.values());
+        for (var i = 0; i < entries.length; i += this.maxBatchSize) {
+            var chunk = entries.slice(i, i + this.maxBatchSize);
+            var rowList;
+            try {
+                //Rows are aligned with keys by native side, so keys of any form accepted by get() match
+                rowList = group.container.callWithSchemaCheck(function() {
+                    return group.container.container.getManyAligned(chunk.map(function(entry) { return entry.key; }));
+                });
+            } catch(err) {
+                //Get each key separately so that an invalid key is reported only to its callers
+                for (var entry of chunk) {
+                    try {
+                        var row = group.container.callWithSchemaCheck(function() {
+                            return group.container.container.get(entry.key);
+                        });
+                        this.resolve(entry, row);
+                    } catch(keyErr) {
+                        var gsErr = convertToGSException(keyErr);
+                        for (var waiter of entry.waiters) {
+                            waiter.reject(gsErr);
+                        }
+                    }
+                }
+                continue;
+            }
+            for (var j = 0; j < chunk.length; j++) {
+                this.resolve(chunk[j], rowList[j]);
+            }
+        }
+    }
+
+    resolve(entry, row) {
+        for (var j = 0; j < entry.waiters.length; j++) {
+            if (row == null) {
+                entry.waiters[j].resolve(null);
+            } else {
+                entry.waiters[j].resolve((j == 0) ? row : row.slice());
+            }
+        }
+    }
+};
+
+/**
+ * Bounded FIFO queue of put operations of a Store with token bucket rate limiting.
+ * Queued operations are executed one by one, each in its own timer callback like other asynchronous methods.
+ */
+class AdmissionController {
+    constructor(maxQueueSize, policy, rate, burst) {
+        this.maxQueueSize = maxQueueSize;
+        this.policy = policy;
+        this.rate = rate;
+        this.burst = burst;
+        this.tokens = burst;
+        this.refillTime = Date.now();
+        //Queue of {cost, func, resolve, reject, time}, items before head are already dequeued
+        this.queue = [];
+        this.head = 0;
+        //Operations waiting for room of the queue by 'block' policy
+        this.blocked = [];
+        this.running = false;
+        this.timer = null;
+        this.maxQueueDepth = 0;
+        this.admittedCount = 0;
+        this.rejectedCount = 0;
+        this.droppedCount = 0;
+        this.completedCount = 0;
+        this.lastWaitMs = null;
+        this.averageWaitMs = null;
+        this.maxWaitMs = 0;
+    }
+
+    get queueDepth() {
+        return this.queue.length - this.head;
+    }
+
+    get metrics() {
+        this.refill();
+        return {
+            queueDepth: this.queueDepth,
+            blockedCount: this.blocked.length,
+            maxQueueDepth: this.maxQueueDepth,
+            admittedCount: this.admittedCount,
+            rejectedCount: this.rejectedCount,
+            droppedCount: this.droppedCount,
+            completedCount: this.completedCount,
+            lastWaitMs: this.lastWaitMs,
+            averageWaitMs: this.averageWaitMs,
+            maxWaitMs: this.maxWaitMs,
+            tokens: (this.rate > 0) ? this.tokens : null
+        };
+    }
+
+    //Ordered operation is not rejected nor dropped, it only keeps the order with operations submitted before
+    submit(cost, func, ordered = false) {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            var item = {cost: cost, func: func, resolve: resolve, reject: reject, time: Date.now(), ordered: ordered};
+            if (ordered) {
+                if (this_.blocked.length > 0) {
+                    this_.blocked.push(item);
+                } else {
+                    this_.enqueue(item);
+                    this_.pump();
+                }
+                return;
+            }
+            if (this_.queueDepth >= this_.maxQueueSize) {
+                if (this_.policy == 'reject' || (this_.policy == 'dropOldest' && this_.queue[this_.head].ordered)) {
+                    this_.rejectedCount++;
+                    reject(new Error('Admission queue is full'));
+                    return;
+                }
+                if (this_.policy == 'block') {
+                    this_.blocked.push(item);
+                    return;
+                }
+                var oldest = this_.dequeue();
+                this_.droppedCount++;
+                oldest.reject(new Error('Dropped by admission control'));
+            }
+            this_.enqueue(item);
+            this_.pump();
+        });
+    }
+
+    enqueue(item) {
+        this.queue.push(item);
+        this.admittedCount++;
+        this.maxQueueDepth = Math.max(this.maxQueueDepth, this.queueDepth);
+    }
+
+    dequeue() {
+        var item = this.queue[this.head];
+        this.queue[this.head] = undefined;
+        this.head++;
+        if (this.head == this.queue.length) {
+            this.queue = [];
+            this.head = 0;
+        } else if (this.head >= 1024 && this.head * 2 >= this.queue.length) {
+            this.queue = this.queue.slice(this.head);
+            this.head = 0;
+        }
+        //Blocked operations enter the queue in order when it has room
+        while (this.blocked.length > 0 && this.queueDepth < this.maxQueueSize) {
+            this.enqueue(this.blocked.shift());
+        }
+        return item;
+    }
+
+    refill() {
+        var now = Date.now();
+        if (this.rate > 0) {
+            this.tokens = Math.min(this.burst, this.tokens + (now - this.refillTime) * this.rate / 1000);
+        }
+        this.refillTime = now;
+    }
+
+    pump() {
+        if (this.running || this.timer != null || this.queueDepth == 0) {
+            return;
+        }
+        var item = this.queue[this.head];
+        if (this.rate > 0) {
+            this.refill();
+            var required = Math.min(item.cost, this.burst);
+            if (this.tokens < required) {
+                var this_ = this;
+                this.timer = setTimeout(function() {
+                    this_.timer = null;
+                    this_.pump();
+                }, Math.ceil((required - this.tokens) * 1000 / this.rate));
+                return;
+            }
+            this.tokens -= item.cost;
+        }
+        this.dequeue();
+        this.running = true;
+        var waitMs = Date.now() - item.time;
+        this.lastWaitMs = waitMs;
+        this.averageWaitMs = (this.averageWaitMs == null) ? waitMs : this.averageWaitMs + (waitMs - this.averageWaitMs) * 0.2;
+        this.maxWaitMs = Math.max(this.maxWaitMs, waitMs);
+        var this_ = this;
+        callAsync(item.func).then(item.resolve, item.reject).then(function() {
+            this_.completedCount++;
+            this_.running = false;
+            this_.pump();
+        });
+    }
+};
+
+/**
+ * Adjust batch size by AIMD: the size is increased by a constant step while a full batch finishes within the target latency,
+ * and multiplied by decreaseFactor when a batch exceeds the target latency or fails.
+ */
+class BatchSizeController {
+    constructor(options) {
+        this.targetLatencyMs = (options.targetLatencyMs === undefined) ? 100 : options.targetLatencyMs;
+        this.minBatchSize = (options.minBatchSize === undefined) ? 1 : options.minBatchSize;
+        this.maxBatchSize = (options.maxBatchSize === undefined) ? 100000 : options.maxBatchSize;
+        this.increaseStep = (options.increaseStep === undefined) ? 100 : options.increaseStep;
+        this.decreaseFactor = (options.decreaseFactor === undefined) ? 0.5 : options.decreaseFactor;
+        var initialBatchSize = (options.initialBatchSize === undefined) ? 1000 : options.initialBatchSize;
+        if (!(this.targetLatencyMs > 0) || !Number.isInteger(this.minBatchSize) || this.minBatchSize <= 0 ||
+                !Number.isInteger(this.maxBatchSize) || this.maxBatchSize < this.minBatchSize ||
+                !Number.isInteger(this.increaseStep) || this.increaseStep <= 0 ||
+                !(this.decreaseFactor > 0 && this.decreaseFactor < 1) || !Number.isInteger(initialBatchSize)) {
+            throw(new Error('Invalid batch size options'));
+        }
+        this.batchSize = Math.min(Math.max(initialBatchSize, this.minBatchSize), this.maxBatchSize);
+        this.batchCount = 0;
+        this.rowCount = 0;
+        this.failureCount = 0;
+        this.increaseCount = 0;
+        this.decreaseCount = 0;
+        this.lastDecision = null;
+        this.lastLatencyMs = null;
+        //Exponential moving averages of successful batches
+        this.averageLatencyMs = null;
+        this.throughput = null;
+    }
+
+    //Update batch size by the result of a batch of rowCount Rows, latencyMs is null if it failed
+    record(rowCount, latencyMs) {
+        this.batchCount++;
+        if (latencyMs == null) {
+            this.failureCount++;
+            return this.decide('decrease');
+        }
+        this.rowCount += rowCount;
+        this.lastLatencyMs = latencyMs;
+        var rate = rowCount * 1000 / Math.max(latencyMs, 0.001);
+        if (this.averageLatencyMs == null) {
+            this.averageLatencyMs = latencyMs;
+            this.throughput = rate;
+        } else {
+            this.averageLatencyMs += (latencyMs - this.averageLatencyMs) * 0.2;
+            this.throughput += (rate - this.throughput) * 0.2;
+        }
+        if (latencyMs > this.targetLatencyMs) {
+            return this.decide('decrease');
+        }
+        //A batch smaller than the size does not tell whether a larger one finishes in time
+        if (rowCount >= this.batchSize) {
+            return this.decide('increase');
+        }
+        return this.decide('hold');
+    }
+
+    decide(decision) {
+        if (decision == 'increase') {
+            var size = Math.min(this.batchSize + this.increaseStep, this.maxBatchSize);
+            if (size == this.batchSize) {
+                decision = 'hold';
+            } else {
+                this.increaseCount++;
+            }
+            this.batchSize = size;
+        } else if (decision == 'decrease') {
+            var size = Math.max(Math.floor(this.batchSize * this.decreaseFactor), this.minBatchSize);
+            if (size == this.batchSize) {
+                decision = 'hold';
+            } else {
+                this.decreaseCount++;
+            }
+            this.batchSize = size;
+        }
+        this.lastDecision = decision;
+        return decision;
+    }
+};
+
+/**
+ * <p>
+ * Collects Rows and puts them in batches, created by Store.createBatchWriter() or Container.createBatchWriter().
+ * <br> A batch is put when the number of collected Rows reaches the current batch size, or options.flushIntervalMs after the first Row of the batch is collected. Batches are put one by one in the order of put() calls.
+ * <br> The batch size starts at options.initialBatchSize. It is increased by options.increaseStep while full batches finish within options.targetLatencyMs, and multiplied by options.decreaseFactor when a batch takes longer or fails.
+ * </p>
+ * @alias BatchWriter
+ * @type {object}
+ * @param {object} options - Options.
+ * @param {number} options.targetLatencyMs=100 - Target time of one multiPut in milliseconds.
+ * @param {number} options.initialBatchSize=1000 - Initial number of Rows in one batch.
+ * @param {number} options.minBatchSize=1 - Lower limit of the batch size.
+ * @param {number} options.maxBatchSize=100000 - Upper limit of the batch size.
+ * @param {number} options.increaseStep=100 - Number of Rows added to the batch size.
+ * @param {number} options.decreaseFactor=0.5 - Factor applied to the batch size.
+ * @param {number} options.flushIntervalMs=10 - Max time in milliseconds a Row waits for other Rows.
+ */
+class BatchWriter {
+    constructor(store, writeFunc, options) {
+        //need reference to avoid gc, batches are put through admission control of the Store
+        this.store = store;
+        //Put a batch of [name, Row] synchronously
+        this.writeFunc = writeFunc;
+        this.controller = new BatchSizeController(options);
+        this.flushIntervalMs = (options.flushIntervalMs === undefined) ? 10 : options.flushIntervalMs;
+        if (!Number.isInteger(this.flushIntervalMs) || this.flushIntervalMs < 0) {
+            throw(new Error('Invalid batch size options'));
+        }
+        //Collected items of {name, row, resolve, reject}
+        this.items = [];
+        this.writing = false;
+        this.timer = null;
+        //Put all collected items regardless of batch size, it is set by flush()
+        this.draining = false;
+        //Promise of the last put() call, batches are put in order
+        this.lastPromise = Promise.resolve();
+        this.closed = false;
+    }
+
+    /**
+     * <p>
+     * Get the current batch size.
+     * </p>
+     * @type {number}
+     * @returns {number} Number of Rows in one batch
+     */
+    get batchSize() {
+        return this.controller.batchSize;
+    }
+
+    /**
+     * <p>
+     * Get metrics of this writer.
+     * <br> averageLatencyMs and throughput (Rows per second) are exponential moving averages of successful batches. lastDecision is one of 'increase', 'decrease' and 'hold'.
      * </p>
-     * @type {void}
-     * @param {boolean} enabled - Indicates whether it enables auto commit mode or not. if True, auto commit mode is enabled. if False, manual commit mode is enabled.
+     * @type {object}
+     * @returns {{batchSize: number, bufferedCount: number, batchCount: number, rowCount: number, failureCount: number, increaseCount: number, decreaseCount: number, lastDecision: string, lastLatencyMs: number, averageLatencyMs: number, throughput: number}} Metrics
      */
-    setAutoCommit(commitFlg) {
-        try {
-            this.container.setAutoCommit(commitFlg);
-        } catch(err) {
-            throw(convertToGSException(err));
-        }
+    get metrics() {
+        var controller = this.controller;
+        return {
+            batchSize: controller.batchSize,
+            bufferedCount: this.items.length,
+            batchCount: controller.batchCount,
+            rowCount: controller.rowCount,
+            failureCount: controller.failureCount,
+            increaseCount: controller.increaseCount,
+            decreaseCount: controller.decreaseCount,
+            lastDecision: controller.lastDecision,
+            lastLatencyMs: controller.lastLatencyMs,
+            averageLatencyMs: controller.averageLatencyMs,
+            throughput: controller.throughput
+        };
     }
 
     /**
      * <p>
-     * Newly creates an arbitrary number of Rows together based on the specified Row objects group.
-     * <br> In the manual commit mode, the target Row is locked.
+     * Add a Row to the current batch.
+     * <br> For a writer created by Store.createBatchWriter(), specify a Container name and a Row. For a writer created by Container.createBatchWriter(), specify only a Row.
      * </p>
      * @type {Promise<void>}
-     * @param {object[][]} rowList - List object corresponding to contents of newly created Row collection
-     * @returns {Promise<void>}
+     * @param {string} name - Container name
+     * @param {object[]} row - Row
+     * @returns {Promise<void>} Resolved when the batch including the Row is put, rejected with the error of the batch
      */
-    multiPut(rowList) {
+    put(name, row = undefined) {
+        if (this.closed) {
+            return Promise.reject(new Error('BatchWriter is closed'));
+        }
+        if (row === undefined) {
+            row = name;
+            name = null;
+        }
         var this_ = this;
-        return new Promise(function(resolve, reject) {
-            setTimeout(function() {
-                try {
-                    resolve(this_.container.multiPut(rowList));
-                } catch(err) {
-                    reject(convertToGSException(err));
-                }
-            }, 0);
+        var promise = new Promise(function(resolve, reject) {
+            this_.items.push({name: name, row: row, resolve: resolve, reject: reject});
         });
+        this.lastPromise = promise;
+        this.schedule();
+        return promise;
     }
 
     /**
      * <p>
-     * Disconnects with GridDB and releases related resources as necessary.
+     * Put all collected Rows.
+     * </p>
+     * @type {Promise<void>}
+     * @returns {Promise<void>} Resolved when all Rows collected before the call are put. Errors are reported by put().
+     */
+    flush() {
+        var promise = this.lastPromise.then(function() {}, function() {});
+        if (this.items.length > 0) {
+            this.draining = true;
+            this.schedule();
+        }
+        return promise;
+    }
+
+    /**
+     * <p>
+     * Put all collected Rows and reject later put() calls.
      * </p>
      * @type {Promise<void>}
      * @returns {Promise<void>}
      */
     close() {
+        this.closed = true;
+        return this.flush();
+    }
+
+    schedule() {
+        if (this.writing) {
+            return;
+        }
+        if (this.items.length >= this.controller.batchSize || (this.draining && this.items.length > 0)) {
+            this.write();
+        } else if (this.items.length > 0 && this.timer == null) {
+            var this_ = this;
+            this.timer = setTimeout(function() {
+                this_.timer = null;
+                if (!this_.writing && this_.items.length > 0) {
+                    this_.write();
+                }
+            }, this.flushIntervalMs);
+        }
+    }
+
+    write() {
+        if (this.timer != null) {
+            clearTimeout(this.timer);
+            this.timer = null;
+        }
+        var batch = this.items.splice(0, this.controller.batchSize);
+        if (this.items.length == 0) {
+            this.draining = false;
+        }
+        this.writing = true;
+        var this_ = this;
+        this.store.callAdmitted(batch.length, function() {
+            var start = process.hrtime.bigint();
+            this_.writeFunc(batch.map(function(item) { return [item.name, item.row]; }));
+            return Number(process.hrtime.bigint() - start) / 1e6;
+        }).then(function(latencyMs) {
+            this_.controller.record(batch.length, latencyMs);
+            for (var item of batch) {
+                item.resolve();
+            }
+        }, function(err) {
+            this_.controller.record(batch.length, null);
+            for (var item of batch) {
+                item.reject(err);
+            }
+        }).then(function() {
+            this_.writing = false;
+            this_.schedule();
+        });
+    }
+};
+
+/**
+ * Rows buffered by Container.put() in group commit mode.
+ * Rows are copied when buffered, and put synchronously in a timer callback, so they are put in the order of put() calls
+ * regardless of which operation triggers it.
+ */
+class GroupCommitBuffer {
+    constructor(container, maxBufferSize, commitWindowMs) {
+        this.container = container;
+        this.maxBufferSize = maxBufferSize;
+        this.commitWindowMs = commitWindowMs;
+        this.rows = [];
+        //The first error of putting buffered Rows in the current transaction
+        this.error = null;
+        //Callbacks of commit() calls merged into the next commit
+        this.commitWaiters = [];
+        this.commitTimer = null;
+        //Flush requested by add() when the buffer is full, shared by add() calls until it starts
+        this.pendingFlush = null;
+    }
+
+    add(row) {
+        //Caller may reuse the array for the next Row before it is put
+        this.rows.push(Array.isArray(row) ? row.slice() : row);
+        if (this.rows.length < this.maxBufferSize) {
+            return Promise.resolve(null);
+        }
+        //Not admitted by the Store, a rejected flush would leave the Row in the transaction
+        if (this.pendingFlush == null) {
+            var this_ = this;
+            this.pendingFlush = callAsync(function() {
+                this_.pendingFlush = null;
+                this_.flush();
+                return null;
+            });
+        }
+        return this.pendingFlush;
+    }
+
+    flush() {
+        if (this.rows.length == 0) {
+            return;
+        }
+        var rows = this.rows;
+        this.rows = [];
+        //Put by the handle of the transaction without reloading schema, commitNow() commits the same handle
+        try {
+            this.container.container.multiPut(rows);
+        } catch(err) {
+            if (this.error == null) {
+                this.error = err;
+            }
+            throw err;
+        }
+    }
+
+    //Commit is executed after operations waiting for admission control of the Store
+    commit() {
         var this_ = this;
+        if (this.commitWindowMs == 0) {
+            return this.container.store.callAdmitted(0, function() {
+                return this_.commitNow();
+            }, true);
+        }
         return new Promise(function(resolve, reject) {
-            setTimeout(function() {
-                try {
-                    resolve(this_.container.close());
-                } catch(err) {
-                    reject(convertToGSException(err));
-                }
-            }, 0);
+            this_.commitWaiters.push({resolve: resolve, reject: reject});
+            if (this_.commitTimer == null) {
+                this_.commitTimer = setTimeout(function() {
+                    this_.commitTimer = null;
+                    var waiters = this_.commitWaiters;
+                    this_.commitWaiters = [];
+                    this_.container.store.callAdmitted(0, function() {
+                        return this_.commitNow();
+                    }, true).then(function() {
+                        for (var waiter of waiters) {
+                            waiter.resolve();
+                        }
+                    }, function(err) {
+                        for (var waiter of waiters) {
+                            waiter.reject(err);
+                        }
+                    });
+                }, this_.commitWindowMs);
+            }
         });
     }
 
-    /**
-     * <p>
-     * Disconnects with GridDB and releases related resources as necessary.
-     * </p>
-     * @type {void}
-     * @returns {void}
-     */
-    closeSync() {
+    //Put buffered Rows and commit, the transaction is aborted if any Rows could not be put
+    commitNow() {
         try {
-            this.container.close();
+            this.flush();
         } catch(err) {
-            throw(convertToGSException(err));
+            //Reported below as the error of the transaction
+        }
+        var nativeContainer = this.container.container;
+        if (this.error != null) {
+            var err = this.error;
+            this.error = null;
+            nativeContainer.abort();
+            throw err;
         }
+        nativeContainer.commit();
+    }
+
+    abort() {
+        var this_ = this;
+        this.rows = [];
+        return this.container.store.callAdmitted(0, function() {
+            //Rows buffered after abort() is called belong to the next transaction
+            this_.error = null;
+            this_.container.container.abort();
+        }, true);
     }
 };
 
@@ -876,6 +2626,78 @@ class Query {
     }
 };
 
+/**
+ * <p>
+ * Provides a TQL statement with parameters which can be executed many times with different values.
+ * <br> The statement is parsed once, and each execution builds the statement, executes it and fetches the result in one native call.
+ * </p>
+ * @alias PreparedQuery
+ * @type {object}
+ */
+class PreparedQuery {
+    constructor(preparedQuery, container) {
+        this.preparedQuery = preparedQuery;
+        //Need reference to avoid gc
+        this.container = container;
+    }
+
+    /**
+     * <p>
+     * Get the number of parameters, it is the largest parameter number in the statement.
+     * </p>
+     * @type {number}
+     * @returns {number} The number of parameters
+     */
+    get parameterCount() {
+        return this.preparedQuery.getParameterCount();
+    }
+
+    /**
+     * <p>
+     * Executes the statement with the specified values and fetches the result.
+     * <br> Type of each value is decided by its type in JavaScript: null, boolean, number (integer is LONG, others are DOUBLE), string, and Date (TIMESTAMP).
+     * Strings are escaped and timestamps are formatted as TO_TIMESTAMP_MS() natively.
+     * </p>
+     * @type {Promise<RowSet>}
+     * @param {Array} values=[] - Values of parameters, values[0] is bound to ?1.
+     * @param {boolean} forUpdate=false - Indicates whether it requests a lock for update or not.
+     * @returns {Promise<RowSet>} RowSet instance, it releases the executed query when it is closed.
+     */
+    execute(values = [], forUpdate = false) {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            setTimeout(function() {
+                try {
+                    var rowSet = this_.preparedQuery.execute(values, forUpdate);
+                    resolve(new RowSet(rowSet, this_));
+                } catch(err) {
+                    reject(convertToGSException(err));
+                }
+            }, 0);
+        });
+    }
+
+    /**
+     * <p>
+     * Releases related resources properly.
+     * </p>
+     * @type {Promise<void>}
+     * @returns {Promise<void>}
+     */
+    close() {
+        var this_ = this;
+        return new Promise(function(resolve, reject) {
+            setTimeout(function() {
+                try {
+                    resolve(this_.preparedQuery.close());
+                } catch(err) {
+                    reject(convertToGSException(err));
+                }
+            }, 0);
+        });
+    }
+};
+
 /**
  * <p>
  * Manages a set of Rows obtained by a query.
@@ -1000,6 +2822,54 @@ class RowSet {
 
     }
 
+    /**
+     * <p>
+     * Reads Rows from the current cursor position and returns their values by column.
+     * <br> Values of numeric and TIMESTAMP columns are stored in Float64Array, NULL is stored as NaN. TIMESTAMP values are epoch milliseconds.
+     * <br> When timestampOutput is false, TIMESTAMP columns are wrapped by TimestampColumn which creates Date only when a value is accessed.
+     * <br> Columns of array types are not supported.
+     * </p>
+     * @type {object}
+     * @param {number} maxRowCount=0 - Max number of Rows to read. 0 means all remaining Rows.
+     * @returns {{rowCount: number, types: Type[], columns: Array[]}} Number of Rows read, type of each column and values of each column.
+     */
+    fetchColumns(maxRowCount = 0) {
+        var result;
+        try {
+            result = this.rowSet.fetchColumns(maxRowCount);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+        if (!this.timestampOutput) {
+            for (var i = 0; i < result.types.length; i++) {
+                if (result.types[i] == griddb.Type.TIMESTAMP) {
+                    result.columns[i] = new TimestampColumn(result.columns[i]);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * <p>
+     * Reads Rows from the current cursor position into SharedArrayBuffer by column.
+     * <br> The result can be posted to worker_threads without copying the values.
+     * <br> A column of numeric, BOOL or TIMESTAMP type is {values: Float64Array}. NULL is stored as NaN, TIMESTAMP values are epoch milliseconds and BOOL values are 0 or 1.
+     * <br> A column of STRING, GEOMETRY or BLOB type is {heap: Uint8Array, offsets: Uint32Array, nulls: Uint8Array}. The value of Row i is heap.subarray(offsets[i], offsets[i + 1]), STRING and GEOMETRY values are encoded in UTF-8. nulls[i] is 1 if the value is NULL.
+     * <br> Columns of array types are not supported.
+     * </p>
+     * @type {object}
+     * @param {number} maxRowCount=0 - Max number of Rows to read. 0 means all remaining Rows.
+     * @returns {{rowCount: number, schema: {name: string, type: Type}[], columns: object[]}} Number of Rows read, name and type of each column and values of each column.
+     */
+    fetchShared(maxRowCount = 0) {
+        try {
+            return this.rowSet.fetchShared(maxRowCount);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
     /**
      * <p>
      * Returns whether a Row set has at least one Row ahead of the current cursor position.
@@ -1030,6 +2900,63 @@ class RowSet {
     }
 }
 
+/**
+ * <p>
+ * TIMESTAMP column of Rows read by RowSet.fetchColumns().
+ * <br> It holds epoch milliseconds and creates Date only on first access of each value.
+ * </p>
+ * @type {object}
+ * @alias TimestampColumn
+ * @property {Float64Array} values - Epoch milliseconds of each Row, NULL is NaN. (Read-only attribute)
+ * @property {number} length - Number of Rows. (Read-only attribute)
+ */
+class TimestampColumn {
+    constructor(values) {
+        this.values = values;
+        this.dates = null;
+    }
+
+    get length() {
+        return this.values.length;
+    }
+
+    /**
+     * <p>
+     * Returns the value of the specified Row as Date.
+     * </p>
+     * @type {Date}
+     * @param {number} index - Index of Row.
+     * @returns {Date} Date of the value, or null if the value is NULL
+     */
+    get(index) {
+        var value = this.values[index];
+        if (value !== value) {
+            return null;
+        }
+        if (this.dates == null) {
+            this.dates = new Array(this.values.length);
+        }
+        var date = this.dates[index];
+        if (date === undefined) {
+            date = new Date(value);
+            this.dates[index] = date;
+        }
+        return date;
+    }
+
+    /**
+     * <p>
+     * Returns the value of the specified Row as epoch milliseconds.
+     * </p>
+     * @type {number}
+     * @param {number} index - Index of Row.
+     * @returns {number} Epoch milliseconds of the value, or NaN if the value is NULL
+     */
+    getTime(index) {
+        return this.values[index];
+    }
+}
+
 /**
  * <p>
  * Stores the result of an aggregation operation.
@@ -1217,6 +3144,39 @@ class PartitionController {
         });
     }
 
+    /**
+     * <p>
+     * Get the partition index corresponding to the specified Container name without inquiry to GridDB cluster.
+     * <br> The partition index is computed locally from the Container name. Only the first call sends inquiries for sample names to verify that the computation matches the GridDB cluster.
+     * <br> If it does not match, or the Container name has node affinity, the result of getPartitionIndexOfContainer is used and memoized for each name.
+     * </p>
+     * @type {number}
+     * @param {string} containerName - Container name
+     * @returns {number} The partition index
+     */
+    partitionOf(containerName) {
+        try {
+            return this.partitionController.partitionOf(containerName);
+        } catch(err) {
+            throw(convertToGSException(err));
+        }
+    }
+
+    /**
+     * <p>
+     * Get the address of the node which owns the specified partition.
+     * </p>
+     * @type {Promise<string>}
+     * @param {number} partitionIndex - The partition index, from 0 to the number of partitions minus one
+     * @returns {Promise<string>} The address of owner node, empty string if the owner is unknown
+     */
+    getOwnerHost(partitionIndex) {
+        var this_ = this;
+        return callAsync(function() {
+            return this_.partitionController.getOwnerHost(partitionIndex);
+        });
+    }
+
     /**
      * <p>
      * The connection status with GridDB is released and related resources are released where necessary.
@@ -1475,8 +3435,133 @@ function convertToGSException(exception) {
     return exception;
 }
 
+/**
+ * Split condition entry of Store.multiGet so that estimated size of Rows of each entry is within request size limit.
+ * Distinct keys of a Container may be split into multiple entries, conditions by range are not split.
+ */
+function splitPredicateEntry(store, predicateEntry) {
+    var limit = store.getRequestSizeLimit();
+    var names = Object.keys(predicateEntry);
+    if (limit <= 0) {
+        return [predicateEntry];
+    }
+    var keyLists = {};
+    var keyCount = 0;
+    for (var name of names) {
+        keyLists[name] = predicateEntry[name].getDistinctKeys();
+        keyCount += keyLists[name].length;
+    }
+    if (keyCount < MULTI_GET_SPLIT_KEY_COUNT) {
+        return [predicateEntry];
+    }
+
+    var chunkList = [{}];
+    var chunkSize = 0;
+    var addEntry = function(name, keys) {
+        var predicate = predicateEntry[name];
+        if (keys.length != keyLists[name].length) {
+            predicate = store.createRowKeyPredicate(predicate.keyType);
+            predicate.setDistinctKeys(keys);
+        }
+        chunkList[chunkList.length - 1][name] = predicate;
+    };
+    for (var name of names) {
+        var keys = keyLists[name];
+        if (keys.length == 0) {
+            chunkList[0][name] = predicateEntry[name];
+            continue;
+        }
+        var rowSize = store.getEstimatedRowSize(name);
+        var start = 0;
+        for (var i = 0; i < keys.length; i++) {
+            if (chunkSize > 0 && chunkSize + rowSize > limit) {
+                if (i > start) {
+                    addEntry(name, keys.slice(start, i));
+                }
+                chunkList.push({});
+                chunkSize = 0;
+                start = i;
+            }
+            chunkSize += rowSize;
+        }
+        addEntry(name, keys.slice(start));
+    }
+    return chunkList;
+}
+
+/**
+ * Split queries of Store.fetchAll so that estimated size of results of each list is within request size limit.
+ * Queries without fetch limit are not counted.
+ */
+function splitQueryList(store, queryList) {
+    var limit = store.getRequestSizeLimit();
+    if (limit <= 0 || queryList.length <= 1) {
+        return [queryList];
+    }
+    var chunkList = [[]];
+    var chunkSize = 0;
+    for (var query of queryList) {
+        var size = Math.max(query.getEstimatedResultSize(), 0);
+        if (chunkSize > 0 && chunkSize + size > limit) {
+            chunkList.push([]);
+            chunkSize = 0;
+        }
+        chunkList[chunkList.length - 1].push(query);
+        chunkSize += size;
+    }
+    return chunkList;
+}
+
+/**
+ * Group queries of Store.fetchAllStream by owner node of the partition of their Container.
+ * Partition index is used as the group if owner is unknown.
+ */
+function groupQueriesByNode(store, queryList) {
+    var controller = store.partitionController.partitionController;
+    var ownerMap = new Map();
+    var groupMap = new Map();
+    for (var query of queryList) {
+        var key = '';
+        var name = query.container ? query.container.schemaKey : null;
+        if (name != null) {
+            var partition = controller.partitionOf(name);
+            if (!ownerMap.has(partition)) {
+                var owner = '';
+                try {
+                    owner = controller.getOwnerHost(partition);
+                } catch(err) {
+                    //Use partition index as the group
+                }
+                ownerMap.set(partition, owner ? owner : '#' + partition);
+            }
+            key = ownerMap.get(partition);
+        }
+        if (!groupMap.has(key)) {
+            groupMap.set(key, []);
+        }
+        groupMap.get(key).push(query);
+    }
+    return Array.from(groupMap.values());
+}
+
+/**
+ * Call native function asynchronously in the same way as other asynchronous methods.
+ */
+function callAsync(func) {
+    return new Promise(function(resolve, reject) {
+        setTimeout(function() {
+            try {
+                resolve(func());
+            } catch(err) {
+                reject(convertToGSException(err));
+            }
+        }, 0);
+    });
+}
+
 var x = {
-        StoreFactory: StoreFactory
+        StoreFactory: StoreFactory,
+        TimestampColumn: TimestampColumn
 };
 
 for (var key in x) {
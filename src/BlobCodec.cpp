@@ -0,0 +1,341 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "BlobCodec.h"
+
+//Header: magic(4) + compression type(1) + original size(8) + checksum(4)
+#define BLOB_HEADER_SIZE 17
+#define BLOB_HEADER_TYPE_OFFSET 4
+#define BLOB_HEADER_ORIGINAL_SIZE_OFFSET 5
+#define BLOB_HEADER_CHECKSUM_OFFSET 13
+
+//Parameters of LZ4 block format
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MATCH_FIND_LIMIT 12
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_LOG 12
+
+namespace griddb {
+
+    static const uint8_t BLOB_MAGIC[4] = {0x89, 'G', 'S', 'Z'};
+
+    static inline uint32_t read32(const uint8_t* ptr) {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static inline void write_le(uint8_t* ptr, uint64_t value, int size) {
+        for (int i = 0; i < size; i++) {
+            ptr[i] = (uint8_t) (value >> (8 * i));
+        }
+    }
+
+    static inline uint64_t read_le(const uint8_t* ptr, int size) {
+        uint64_t value = 0;
+        for (int i = 0; i < size; i++) {
+            value |= ((uint64_t) ptr[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    static inline void write_length(vector<char>* out, size_t length) {
+        while (length >= 255) {
+            out->push_back((char) 255);
+            length -= 255;
+        }
+        out->push_back((char) length);
+    }
+
+    /**
+     * @brief Check compression type is supported
+     * @param compressionType Compression type
+     * @return True if compression type is supported
+     */
+    bool BlobCodec::is_valid_type(int compressionType) {
+        return compressionType == CompressionType::NONE ||
+                compressionType == CompressionType::LZ4;
+    }
+
+    /**
+     * @brief Encode BLOB value with header
+     * @param compressionType Compression type
+     * @param *data BLOB value
+     * @param size Size of BLOB value
+     * @param *out The vector to store encoded value
+     */
+    void BlobCodec::encode(int compressionType, const void* data, size_t size, vector<char>* out) {
+        out->clear();
+        out->resize(BLOB_HEADER_SIZE);
+        if (compressionType == CompressionType::LZ4) {
+            compress_lz4((const uint8_t*) data, size, out);
+            if (out->size() >= BLOB_HEADER_SIZE + size) {
+                //Not compressible, store original data
+                compressionType = CompressionType::NONE;
+                out->resize(BLOB_HEADER_SIZE);
+            }
+        }
+        if (compressionType == CompressionType::NONE && size > 0) {
+            out->insert(out->end(), (const char*) data, (const char*) data + size);
+        }
+
+        uint8_t* header = (uint8_t*) &(*out)[0];
+        memcpy(header, BLOB_MAGIC, sizeof(BLOB_MAGIC));
+        header[BLOB_HEADER_TYPE_OFFSET] = (uint8_t) compressionType;
+        write_le(header + BLOB_HEADER_ORIGINAL_SIZE_OFFSET, size, 8);
+        write_le(header + BLOB_HEADER_CHECKSUM_OFFSET, checksum(data, size), 4);
+    }
+
+    /**
+     * @brief Decode BLOB value which has header
+     * @param *data BLOB value
+     * @param size Size of BLOB value
+     * @param *out The vector to store original value
+     * @return False if value does not have valid header, it means value is not encoded
+     */
+    bool BlobCodec::decode(const void* data, size_t size, vector<char>* out) {
+        const uint8_t* header = (const uint8_t*) data;
+        if (size < BLOB_HEADER_SIZE || memcmp(header, BLOB_MAGIC, sizeof(BLOB_MAGIC)) != 0) {
+            return false;
+        }
+        int compressionType = header[BLOB_HEADER_TYPE_OFFSET];
+        uint64_t originalSize = read_le(header + BLOB_HEADER_ORIGINAL_SIZE_OFFSET, 8);
+        const uint8_t* payload = header + BLOB_HEADER_SIZE;
+        size_t payloadSize = size - BLOB_HEADER_SIZE;
+
+        switch (compressionType) {
+        case CompressionType::NONE:
+            if (originalSize != payloadSize) {
+                return false;
+            }
+            out->assign((const char*) payload, (const char*) payload + payloadSize);
+            break;
+        case CompressionType::LZ4:
+            //LZ4 can not expand data more than 255 times
+            if (originalSize / 255 > payloadSize) {
+                return false;
+            }
+            out->resize(originalSize);
+            if (!decompress_lz4(payload, payloadSize,
+                    (uint8_t*) (originalSize > 0 ? &(*out)[0] : NULL), originalSize)) {
+                out->clear();
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+
+        if (read_le(header + BLOB_HEADER_CHECKSUM_OFFSET, 4) !=
+                checksum(out->empty() ? NULL : &(*out)[0], out->size())) {
+            out->clear();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Encode BLOB fields of row in place
+     * @param *row A pointer stores row data
+     * @param *compressionList Compression type of each column, NULL means no compression
+     * @param columnCount Number of column in row
+     */
+    void BlobCodec::encode_row(GSRow* row, const int* compressionList, int columnCount) {
+        if (compressionList == NULL) {
+            return;
+        }
+        vector<char> encoded;
+        for (int i = 0; i < columnCount; i++) {
+            if (compressionList[i] == CompressionType::NONE) {
+                continue;
+            }
+            GSBool nullValue;
+            GSResult ret = gsGetRowFieldNull(row, (int32_t) i, &nullValue);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(row, ret);
+            }
+            if (nullValue) {
+                continue;
+            }
+            GSBlob blobValue;
+            ret = gsGetRowFieldAsBlob(row, (int32_t) i, &blobValue);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(row, ret);
+            }
+            try {
+                encode(compressionList[i], blobValue.data, blobValue.size, &encoded);
+            } catch (bad_alloc& ba) {
+                throw GSException(row, "Memory allocation error");
+            }
+            blobValue.data = &encoded[0];
+            blobValue.size = encoded.size();
+            ret = gsSetRowFieldByBlob(row, (int32_t) i, &blobValue);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(row, ret);
+            }
+        }
+    }
+
+    /**
+     * FNV-1a hash of original data to detect values which only look like encoded
+     */
+    uint32_t BlobCodec::checksum(const void* data, size_t size) {
+        const uint8_t* ptr = (const uint8_t*) data;
+        uint32_t hash = 2166136261U;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= ptr[i];
+            hash *= 16777619U;
+        }
+        return hash;
+    }
+
+    /**
+     * Compress data to LZ4 block format and append to out
+     */
+    void BlobCodec::compress_lz4(const uint8_t* src, size_t size, vector<char>* out) {
+        size_t anchor = 0;
+        size_t pos = 0;
+        out->reserve(out->size() + size + size / 255 + 16);
+
+        if (size > LZ4_MATCH_FIND_LIMIT) {
+            vector<uint32_t> hashTable(1 << LZ4_HASH_LOG, 0);
+            const size_t matchFindLimit = size - LZ4_MATCH_FIND_LIMIT;
+            const size_t matchLimit = size - LZ4_LAST_LITERALS;
+
+            while (pos < matchFindLimit) {
+                uint32_t sequence = read32(src + pos);
+                uint32_t hash = (sequence * 2654435761U) >> (32 - LZ4_HASH_LOG);
+                //Position is stored with +1 so that 0 means empty
+                size_t ref = hashTable[hash];
+                hashTable[hash] = (uint32_t) (pos + 1);
+                if (ref == 0 || pos - (ref - 1) > LZ4_MAX_OFFSET ||
+                        read32(src + ref - 1) != sequence) {
+                    pos++;
+                    continue;
+                }
+                ref--;
+
+                size_t matchLength = LZ4_MIN_MATCH;
+                while (pos + matchLength < matchLimit &&
+                        src[ref + matchLength] == src[pos + matchLength]) {
+                    matchLength++;
+                }
+
+                size_t literalLength = pos - anchor;
+                size_t tokenPos = out->size();
+                out->push_back(0);
+                uint8_t token = 0;
+                if (literalLength >= 15) {
+                    token = 15 << 4;
+                    write_length(out, literalLength - 15);
+                } else {
+                    token = (uint8_t) (literalLength << 4);
+                }
+                out->insert(out->end(), (const char*) src + anchor, (const char*) src + pos);
+                size_t offset = pos - ref;
+                out->push_back((char) (offset & 0xFF));
+                out->push_back((char) (offset >> 8));
+                size_t extraLength = matchLength - LZ4_MIN_MATCH;
+                if (extraLength >= 15) {
+                    token |= 15;
+                    write_length(out, extraLength - 15);
+                } else {
+                    token |= (uint8_t) extraLength;
+                }
+                (*out)[tokenPos] = (char) token;
+
+                pos += matchLength;
+                anchor = pos;
+            }
+        }
+
+        //Last literals
+        size_t literalLength = size - anchor;
+        if (literalLength >= 15) {
+            out->push_back((char) (15 << 4));
+            write_length(out, literalLength - 15);
+        } else {
+            out->push_back((char) (literalLength << 4));
+        }
+        out->insert(out->end(), (const char*) src + anchor, (const char*) src + size);
+    }
+
+    /**
+     * Decompress LZ4 block, return false if input is malformed
+     */
+    bool BlobCodec::decompress_lz4(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize) {
+        size_t in = 0;
+        size_t outPos = 0;
+        while (in < size) {
+            uint8_t token = src[in++];
+            size_t literalLength = token >> 4;
+            if (literalLength == 15) {
+                uint8_t b;
+                do {
+                    if (in >= size) {
+                        return false;
+                    }
+                    b = src[in++];
+                    literalLength += b;
+                } while (b == 255);
+            }
+            if (literalLength > size - in || literalLength > dstSize - outPos) {
+                return false;
+            }
+            if (literalLength > 0) {
+                memcpy(dst + outPos, src + in, literalLength);
+            }
+            in += literalLength;
+            outPos += literalLength;
+            if (in == size) {
+                //Last sequence has only literals
+                break;
+            }
+
+            if (size - in < 2) {
+                return false;
+            }
+            size_t offset = src[in] | (src[in + 1] << 8);
+            in += 2;
+            if (offset == 0 || offset > outPos) {
+                return false;
+            }
+            size_t matchLength = token & 15;
+            if (matchLength == 15) {
+                uint8_t b;
+                do {
+                    if (in >= size) {
+                        return false;
+                    }
+                    b = src[in++];
+                    matchLength += b;
+                } while (b == 255);
+            }
+            matchLength += LZ4_MIN_MATCH;
+            if (matchLength > dstSize - outPos) {
+                return false;
+            }
+            //Byte by byte copy because match may overlap output
+            for (size_t i = 0; i < matchLength; i++) {
+                dst[outPos + i] = dst[outPos - offset + i];
+            }
+            outPos += matchLength;
+        }
+        return outPos == dstSize;
+    }
+
+} /* namespace griddb */
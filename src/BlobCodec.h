@@ -0,0 +1,52 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _BLOB_CODEC_H_
+#define _BLOB_CODEC_H_
+
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+
+#include "gridstore.h"
+#include "EnumValue.h"
+#include "GSException.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Client side compression of BLOB values.
+ * Compressed value starts with a header (magic, compression type, original size, checksum),
+ * values without a valid header are handled as uncompressed data.
+ */
+class BlobCodec {
+    public:
+        static bool is_valid_type(int compressionType);
+        static void encode(int compressionType, const void* data, size_t size, vector<char>* out);
+        static bool decode(const void* data, size_t size, vector<char>* out);
+        static void encode_row(GSRow* row, const int* compressionList, int columnCount);
+
+    private:
+        static uint32_t checksum(const void* data, size_t size);
+        static void compress_lz4(const uint8_t* src, size_t size, vector<char>* out);
+        static bool decompress_lz4(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize);
+};
+
+} /* namespace griddb */
+
+#endif /* _BLOB_CODEC_H_ */
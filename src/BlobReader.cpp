@@ -0,0 +1,101 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "BlobReader.h"
+
+namespace griddb {
+
+    /**
+     * @brief Constructor a new BlobReader::BlobReader object
+     * @param *row A pointer stores row data, BlobReader takes ownership of it
+     * @param column Index of BLOB column
+     */
+    BlobReader::BlobReader(GSRow* row, int column) : mRow(row), mData(NULL),
+            mSize(0), mPosition(0) {
+        GSBool nullValue;
+        GSResult ret = gsGetRowFieldNull(mRow, (int32_t) column, &nullValue);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mRow, ret);
+        }
+        if (nullValue) {
+            return;
+        }
+
+        GSBlob blobValue;
+        ret = gsGetRowFieldAsBlob(mRow, (int32_t) column, &blobValue);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mRow, ret);
+        }
+        mData = (const GSChar*) blobValue.data;
+        mSize = blobValue.size;
+        try {
+            if (BlobCodec::decode(mData, mSize, &mDecoded)) {
+                //Original value is kept, row memory is not needed any more
+                mData = mDecoded.empty() ? NULL : &mDecoded[0];
+                mSize = mDecoded.size();
+                gsCloseRow(&mRow);
+                mRow = NULL;
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException(mRow, "Memory allocation error");
+        }
+    }
+
+    BlobReader::~BlobReader() {
+        close();
+    }
+
+    /**
+     * @brief Release BlobReader resource
+     */
+    void BlobReader::close() {
+        if (mRow != NULL) {
+            gsCloseRow(&mRow);
+            mRow = NULL;
+        }
+        vector<char>().swap(mDecoded);
+        mData = NULL;
+        mSize = 0;
+        mPosition = 0;
+    }
+
+    /**
+     * @brief Get size of BLOB value
+     * @return Size of BLOB value
+     */
+    size_t BlobReader::get_size() {
+        return mSize;
+    }
+
+    /**
+     * @brief Read next chunk of BLOB value
+     * @param maxSize Max size of chunk
+     * @param **chunk A pointer to data of chunk, it is valid until next call
+     * @param *chunkSize Size of chunk, 0 if all data has been read
+     */
+    void BlobReader::read(size_t maxSize, const GSChar** chunk, size_t* chunkSize) {
+        assert(chunk != NULL);
+        assert(chunkSize != NULL);
+        if (maxSize == 0) {
+            throw GSException("Chunk size must be greater than 0");
+        }
+        size_t remaining = mSize - mPosition;
+        *chunkSize = remaining < maxSize ? remaining : maxSize;
+        *chunk = (*chunkSize > 0) ? mData + mPosition : NULL;
+        mPosition += *chunkSize;
+    }
+
+} /* namespace griddb */
@@ -0,0 +1,56 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _BLOB_READER_H_
+#define _BLOB_READER_H_
+
+#include <vector>
+#include <assert.h>
+#include <string.h>
+
+#include "gridstore.h"
+#include "GSException.h"
+#include "BlobCodec.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Reads a BLOB value got by Container::get_blob_reader chunk by chunk
+ */
+class BlobReader {
+    GSRow* mRow;
+    const GSChar* mData;
+    size_t mSize;
+    size_t mPosition;
+    vector<char> mDecoded;
+
+    friend class Container;
+
+    public:
+        ~BlobReader();
+        void close();
+        size_t get_size();
+        void read(size_t maxSize, const GSChar** chunk, size_t* chunkSize);
+
+    private:
+        BlobReader(GSRow* row, int column);
+};
+
+} /* namespace griddb */
+
+#endif /* _BLOB_READER_H_ */
@@ -0,0 +1,85 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "BlobWriter.h"
+
+namespace griddb {
+
+    /**
+     * @brief Constructor a new BlobWriter::BlobWriter object
+     * @param column Index of BLOB column
+     * @param expectedSize Expected size of BLOB value to reserve memory at once, 0 if unknown
+     */
+    BlobWriter::BlobWriter(int column, size_t expectedSize) : mColumn(column) {
+        if (expectedSize > 0) {
+            try {
+                mBuffer.reserve(expectedSize);
+            } catch (bad_alloc& ba) {
+                throw GSException("Memory allocation error");
+            }
+        }
+    }
+
+    BlobWriter::~BlobWriter() {
+    }
+
+    /**
+     * @brief Append a chunk to BLOB value
+     * @param *chunk Data of chunk
+     * @param chunkSize Size of chunk
+     */
+    void BlobWriter::append(const GSChar* chunk, size_t chunkSize) {
+        if (chunkSize == 0) {
+            return;
+        }
+        try {
+            mBuffer.insert(mBuffer.end(), chunk, chunk + chunkSize);
+        } catch (bad_alloc& ba) {
+            throw GSException("Memory allocation error");
+        }
+    }
+
+    /**
+     * @brief Get size of BLOB value written so far
+     * @return Size of BLOB value
+     */
+    size_t BlobWriter::get_size() {
+        return mBuffer.size();
+    }
+
+    /**
+     * @brief Get index of BLOB column
+     * @return Index of BLOB column
+     */
+    int BlobWriter::get_column() {
+        return mColumn;
+    }
+
+    /**
+     * @brief Discard BLOB value written so far and release memory
+     */
+    void BlobWriter::clear() {
+        vector<char>().swap(mBuffer);
+    }
+
+    /**
+     * Get BLOB value written so far
+     */
+    const GSChar* BlobWriter::get_data() {
+        return mBuffer.empty() ? NULL : &mBuffer[0];
+    }
+
+} /* namespace griddb */
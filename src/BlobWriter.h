@@ -0,0 +1,53 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _BLOB_WRITER_H_
+#define _BLOB_WRITER_H_
+
+#include <vector>
+#include <string.h>
+
+#include "gridstore.h"
+#include "GSException.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Accumulates chunks of a BLOB value which is put by Container::put_blob
+ */
+class BlobWriter {
+    int mColumn;
+    vector<char> mBuffer;
+
+    friend class Container;
+
+    public:
+        ~BlobWriter();
+        void append(const GSChar* chunk, size_t chunkSize);
+        size_t get_size();
+        int get_column();
+        void clear();
+
+    private:
+        BlobWriter(int column, size_t expectedSize = 0);
+        const GSChar* get_data();
+};
+
+} /* namespace griddb */
+
+#endif /* _BLOB_WRITER_H_ */
@@ -20,57 +20,18 @@
 
 namespace griddb {
 
-    Container::Container(GSContainer *container, GSContainerInfo* containerInfo) : mContainer(container),
-            mContainerInfo(NULL), mRow(NULL), mTypeList(NULL), timestamp_output_with_float(false) {
+    Container::Container(GSContainer *container, const ContainerSchemaPtr& schema, GSGridStore* store) :
+            mContainer(container), mGridStore(store), mSchema(schema), mContainerInfo(NULL), mRow(NULL), mCompressionList(NULL),
+            mRowPoolSize(DEFAULT_ROW_POOL_SIZE), mAutoCommit(true), timestamp_output_with_float(false) {
         assert(container != NULL);
-        assert(containerInfo != NULL);
+        assert(schema);
+        //Schema is not got from GSRow: there is issue from C-API about using share memory that
+        // make GSContainerInfo* pointer error in case : create gsRow, get GSContainerInfo from gsRow, set field of gs Row
+        mContainerInfo = mSchema->gs_info();
         GSResult ret = gsCreateRowByContainer(mContainer, &mRow);
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mContainer, ret);
         }
-
-        GSColumnInfo* columnInfoList;
-        //create local mContainerInfo: there is issue from C-API about using share memory that
-        // make GSContainerInfo* pointer error in case : create gsRow, get GSContainerInfo from gsRow, set field of gs Row
-        try {
-            mContainerInfo = new GSContainerInfo();
-            (*mContainerInfo) = (*containerInfo); // this is for set for normal data (int, float, double..)
-            mContainerInfo->name = NULL;
-            if (containerInfo->name) {
-                Util::strdup(&(mContainerInfo->name), containerInfo->name);
-            }
-
-            columnInfoList = new GSColumnInfo[containerInfo->columnCount]();
-            mContainerInfo->columnInfoList = columnInfoList;
-
-            for (int i = 0; i < containerInfo->columnCount; i++) {
-                columnInfoList[i].type = containerInfo->columnInfoList[i].type;
-                if (containerInfo->columnInfoList[i].name) {
-                    Util::strdup(&(columnInfoList[i].name), containerInfo->columnInfoList[i].name);
-                } else {
-                    columnInfoList[i].name = NULL;
-                }
-
-                columnInfoList[i].indexTypeFlags = containerInfo->columnInfoList[i].indexTypeFlags;
-                columnInfoList[i].options = containerInfo->columnInfoList[i].options;
-            }
-
-            mTypeList = new GSType[mContainerInfo->columnCount]();
-        } catch (bad_alloc& ba) {
-            //Memory allocation error
-            freeMemoryContainer();
-            throw GSException(mContainer, "Memory allocation error");
-        }
-        
-        mContainerInfo->timeSeriesProperties = NULL;
-        mContainerInfo->triggerInfoList = NULL;
-        mContainerInfo->dataAffinity = NULL;
-
-        if (mTypeList && mContainerInfo->columnInfoList) {
-            for (int i = 0; i < mContainerInfo->columnCount; i++){
-                mTypeList[i] = mContainerInfo->columnInfoList[i].type;
-            }
-        }
     }
 
     Container::~Container() {
@@ -81,25 +42,29 @@ namespace griddb {
     }
 
     void Container::freeMemoryContainer() {
-        if (mContainerInfo) {
-            for (int i = 0; i < mContainerInfo->columnCount; i++) {
-                if (mContainerInfo->columnInfoList && mContainerInfo->columnInfoList[i].name) {
-                    delete[] mContainerInfo->columnInfoList[i].name;
-                }
-            }
-            if (mContainerInfo->columnInfoList) {
-                delete[] mContainerInfo->columnInfoList;
-            }
-            if (mContainerInfo->name) {
-                delete[] mContainerInfo->name;
-            }
-            delete mContainerInfo;
-            mContainerInfo = NULL;
+        if (mCompressionList) {
+            delete[] mCompressionList;
+            mCompressionList = NULL;
         }
-        if (mTypeList) {
-            delete[] mTypeList;
-            mTypeList = NULL;
+    }
+
+    /**
+     * Set client side compression type of each column, NULL means no compression
+     */
+    void Container::set_compression_list(const int* compressionList) {
+        if (mCompressionList) {
+            delete[] mCompressionList;
+            mCompressionList = NULL;
         }
+        if (compressionList == NULL) {
+            return;
+        }
+        try {
+            mCompressionList = new int[mContainerInfo->columnCount]();
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+        memcpy(mCompressionList, compressionList, mContainerInfo->columnCount * sizeof(int));
     }
 
     /**
@@ -107,10 +72,13 @@ namespace griddb {
      * @param allRelated Indicates whether all unclosed resources in the lower resources related to the specified GSContainer will be closed or not
      */
     void Container::close(GSBool allRelated) {
+        release_many_rows();
+        clear_row_pool();
         if (mRow != NULL) {
             gsCloseRow(&mRow);
             mRow = NULL;
         }
+        release_retired_resources(true, allRelated);
 
         //Release container and all related resources
         if (mContainer != NULL) {
@@ -120,6 +88,104 @@ namespace griddb {
         freeMemoryContainer();
     }
 
+    /**
+     * Replace container handle and schema after schema is changed on server.
+     * Current handle is kept while Query and RowSet created before may use it.
+     * The new handle uses the same commit mode, and the transaction of the current handle is aborted in the manual commit mode.
+     * Client side compression setting of a column is kept only if the new schema has a BLOB column with the same name.
+     */
+    void Container::reset(GSContainer* container, const ContainerSchemaPtr& schema) {
+        release_retired_resources(false);
+        GSRow* row;
+        GSResult ret = gsCreateRowByContainer(container, &row);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(container, ret);
+        }
+        if (!mAutoCommit) {
+            ret = gsSetAutoCommit(container, GS_FALSE);
+            if (!GS_SUCCEEDED(ret)) {
+                GSException exception(container, ret);
+                gsCloseRow(&row);
+                throw GSException(&exception);
+            }
+        }
+        //Current compression list is kept with the handle since Query and RowSet created before refer to it
+        RetiredResource retired = {mContainer, mRow, mCompressionList, mSchema};
+        int* compressionList = NULL;
+        try {
+            compressionList = remap_compression_list(schema->gs_info());
+            mRetiredList.push_back(retired);
+        } catch (bad_alloc& ba) {
+            delete[] compressionList;
+            gsCloseRow(&row);
+            throw GSException(container, "Memory allocation error");
+        }
+        if (!mAutoCommit) {
+            //Release locks of the transaction which can not be continued by the new handle
+            gsAbort(mContainer);
+        }
+        //Pooled rows have layout of old schema
+        release_many_rows();
+        clear_row_pool();
+        mContainer = container;
+        mRow = row;
+        mSchema = schema;
+        mContainerInfo = mSchema->gs_info();
+        mCompressionList = compressionList;
+    }
+
+    /**
+     * Create compression list for new schema from current one by column name, only BLOB columns are kept.
+     * NULL is returned if no column is compressed
+     */
+    int* Container::remap_compression_list(const GSContainerInfo* info) {
+        if (mCompressionList == NULL) {
+            return NULL;
+        }
+        int* compressionList = NULL;
+        for (size_t i = 0; i < info->columnCount; i++) {
+            if (info->columnInfoList[i].type != GS_TYPE_BLOB) {
+                continue;
+            }
+            for (size_t j = 0; j < mContainerInfo->columnCount; j++) {
+                const GSColumnInfo& column = mContainerInfo->columnInfoList[j];
+                if (column.type != GS_TYPE_BLOB || mCompressionList[j] == CompressionType::NONE ||
+                        strcmp(column.name, info->columnInfoList[i].name) != 0) {
+                    continue;
+                }
+                if (compressionList == NULL) {
+                    compressionList = new int[info->columnCount]();
+                }
+                compressionList[i] = mCompressionList[j];
+                break;
+            }
+        }
+        return compressionList;
+    }
+
+    /**
+     * Close resources replaced by reset, only ones which are not used by Query and RowSet unless all is true
+     */
+    void Container::release_retired_resources(bool all, GSBool allRelated) {
+        size_t kept = 0;
+        for (size_t i = 0; i < mRetiredList.size(); i++) {
+            RetiredResource& retired = mRetiredList[i];
+            if (!all && retired.schema.use_count() > 1) {
+                if (kept != i) {
+                    mRetiredList[kept] = retired;
+                }
+                kept++;
+                continue;
+            }
+            gsCloseRow(&retired.row);
+            gsCloseContainer(&retired.container, allRelated);
+            if (retired.compressionList) {
+                delete[] retired.compressionList;
+            }
+        }
+        mRetiredList.resize(kept);
+    }
+
     /**
      * @brief Removes the specified type of index among indexes on the specified Column
      * @param *column_name Column name
@@ -186,6 +252,7 @@ namespace griddb {
      */
     bool Container::put(GSRow *row) {
         GSBool bExists;
+        BlobCodec::encode_row(mRow, mCompressionList, mContainerInfo->columnCount);
         GSResult ret = gsPutRow(mContainer, NULL, mRow, &bExists);
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mContainer, ret);
@@ -225,6 +292,7 @@ namespace griddb {
      * @return Return a Query object
      */
     Query* Container::query(const char* query) {
+        release_retired_resources(false);
         GSQuery *pQuery;
         GSResult ret = gsQuery(mContainer, query, &pQuery);
 
@@ -233,7 +301,7 @@ namespace griddb {
         }
 
         try {
-            Query* queryObj = new Query(pQuery, mContainerInfo, mRow);
+            Query* queryObj = new Query(pQuery, mSchema, mRow, mCompressionList, query);
             return queryObj;
         } catch(bad_alloc& ba) {
             gsCloseQuery(&pQuery);
@@ -241,6 +309,31 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Create a reusable query from TQL statement with parameters ?1, ?2, ...
+     * @param *query TQL statement, "?" followed by a number is replaced with bound value at execution
+     * @return The pointer to PreparedQuery object
+     */
+    PreparedQuery* Container::prepare(const char* query) {
+        release_retired_resources(false);
+        PreparedQuery* preparedQuery;
+        try {
+            preparedQuery = new PreparedQuery(mContainer, mSchema, mRow, mCompressionList);
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+        try {
+            preparedQuery->parse(query);
+        } catch (bad_alloc& ba) {
+            delete preparedQuery;
+            throw GSException(mContainer, "Memory allocation error");
+        } catch (GSException& e) {
+            delete preparedQuery;
+            throw;
+        }
+        return preparedQuery;
+    }
+
     /**
      * @brief Set auto commit to true or false.
      * @param enabled Indicates whether container enables auto commit mode or not
@@ -252,6 +345,7 @@ namespace griddb {
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mContainer, ret);
         }
+        mAutoCommit = enabled;
     }
 
     /**
@@ -265,15 +359,9 @@ namespace griddb {
     }
 
     /**
-     * @brief Returns the content of a Row.
-     * @param *keyFields The variable to store the target Row key
-     * @param *rowdata The Row object to store the contents of target Row to be obtained
-     * @return Return bool value to indicate row exist or not
+     * Get pointer to row key value after checking its type
      */
-    GSBool Container::get(Field* keyFields, GSRow *rowdata) {
-        assert(keyFields != NULL);
-        GSBool exists;
-        GSResult ret;
+    void* Container::get_key_pointer(Field* keyFields) {
         void *key = NULL;
         switch (keyFields->type) {
         case GS_TYPE_STRING:
@@ -303,6 +391,150 @@ namespace griddb {
         default:
             throw GSException("wrong type of rowKey field");
         }
+        return key;
+    }
+
+    /**
+     * Check column is a BLOB column of this container
+     */
+    void Container::check_blob_column(int column) {
+        if (column < 0 || column >= mContainerInfo->columnCount) {
+            throw GSException(mContainer, "Index out of bound error");
+        }
+        if (mSchema->get_type_list()[column] != GS_TYPE_BLOB) {
+            throw GSException(mContainer, "Column type should be BLOB");
+        }
+    }
+
+    /**
+     * @brief Create a writer which accumulates chunks of a BLOB value
+     * @param column Index of BLOB column
+     * @param expected_size Expected size of BLOB value to reserve memory at once, 0 if unknown
+     * @return A pointer to BlobWriter, it is passed to put_blob()
+     */
+    BlobWriter* Container::create_blob_writer(int column, size_t expected_size) {
+        check_blob_column(column);
+        try {
+            return new BlobWriter(column, expected_size);
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+    }
+
+    /**
+     * @brief Put BLOB value accumulated by writer to the row with specified row key.
+     * Other columns keep current values, or default values if row does not exist.
+     * The row is read and put by separate requests. In the manual commit mode the row is locked when it is read,
+     * but in the auto commit mode an update of other columns between the requests is overwritten.
+     * @param *keyFields The variable to store the target Row key
+     * @param *writer A writer which accumulates BLOB value, the value is released as soon as it is copied
+     * @return Return bool value to indicate row exist or not
+     */
+    bool Container::put_blob(Field* keyFields, BlobWriter* writer) {
+        assert(keyFields != NULL);
+        if (writer == NULL) {
+            throw GSException(mContainer, "Argument blob writer can not be null");
+        }
+        int column = writer->get_column();
+        check_blob_column(column);
+        void* key = get_key_pointer(keyFields);
+
+        GSRow* row;
+        GSResult ret = gsCreateRowByContainer(mContainer, &row);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mContainer, ret);
+        }
+        GSBool exists;
+        if (mAutoCommit) {
+            ret = gsGetRow(mContainer, key, row, &exists);
+        } else {
+            ret = gsGetRowForUpdate(mContainer, key, row, &exists);
+        }
+        if (GS_SUCCEEDED(ret) && !exists) {
+            ret = gsSetRowFieldGeneral(row, 0, &keyFields->value, keyFields->type);
+        }
+
+        GSBlob blobValue;
+        blobValue.data = writer->get_data();
+        blobValue.size = writer->get_size();
+        vector<char> encoded;
+        if (GS_SUCCEEDED(ret) && mCompressionList != NULL &&
+                mCompressionList[column] != CompressionType::NONE) {
+            try {
+                BlobCodec::encode(mCompressionList[column], blobValue.data, blobValue.size, &encoded);
+            } catch (bad_alloc& ba) {
+                gsCloseRow(&row);
+                throw GSException(mContainer, "Memory allocation error");
+            }
+            writer->clear();
+            blobValue.data = &encoded[0];
+            blobValue.size = encoded.size();
+        }
+        if (GS_SUCCEEDED(ret)) {
+            ret = gsSetRowFieldByBlob(row, (int32_t) column, &blobValue);
+        }
+        //Row has its own copy of the value
+        vector<char>().swap(encoded);
+        writer->clear();
+        if (GS_SUCCEEDED(ret)) {
+            ret = gsPutRow(mContainer, NULL, row, &exists);
+        }
+        gsCloseRow(&row);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mContainer, ret);
+        }
+        return (bool) exists;
+    }
+
+    /**
+     * @brief Create a reader of BLOB value of the row with specified row key
+     * @param *keyFields The variable to store the target Row key
+     * @param column Index of BLOB column
+     * @return A pointer to BlobReader, NULL if row does not exist
+     */
+    BlobReader* Container::get_blob_reader(Field* keyFields, int column) {
+        assert(keyFields != NULL);
+        check_blob_column(column);
+        void* key = get_key_pointer(keyFields);
+
+        GSRow* row;
+        GSResult ret = gsCreateRowByContainer(mContainer, &row);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mContainer, ret);
+        }
+        GSBool exists;
+        ret = gsGetRow(mContainer, key, row, &exists);
+        if (!GS_SUCCEEDED(ret)) {
+            gsCloseRow(&row);
+            throw GSException(mContainer, ret);
+        }
+        if (!exists) {
+            gsCloseRow(&row);
+            return NULL;
+        }
+
+        try {
+            return new BlobReader(row, column);
+        } catch (bad_alloc& ba) {
+            gsCloseRow(&row);
+            throw GSException(mContainer, "Memory allocation error");
+        } catch (GSException& e) {
+            gsCloseRow(&row);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Returns the content of a Row.
+     * @param *keyFields The variable to store the target Row key
+     * @param *rowdata The Row object to store the contents of target Row to be obtained
+     * @return Return bool value to indicate row exist or not
+     */
+    GSBool Container::get(Field* keyFields, GSRow *rowdata) {
+        assert(keyFields != NULL);
+        GSBool exists;
+        GSResult ret;
+        void *key = get_key_pointer(keyFields);
 
         ret = gsGetRow(mContainer, key, mRow, &exists);
         if (!GS_SUCCEEDED(ret)) {
@@ -362,6 +594,234 @@ namespace griddb {
         return (bool) exists;
     }
 
+    /**
+     * @brief Delete rows corresponding to multiple row keys
+     * @param *keyList The array of row keys
+     * @param keyCount The number of row keys
+     * @return The number of rows which existed
+     */
+    int64_t Container::multi_remove(Field* keyList, size_t keyCount) {
+        assert(keyList != NULL || keyCount == 0);
+        int64_t count = 0;
+        for (size_t i = 0; i < keyCount; i++) {
+            GSBool exists = GS_FALSE;
+            GSResult ret = gsDeleteRow(mContainer, get_key_pointer(&keyList[i]), &exists);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(mContainer, ret);
+            }
+            if (exists) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Get rows corresponding to multiple row keys by one request
+     * @param *keyList The array of row keys
+     * @param keyCount The number of row keys
+     * @param ***rowList A pointer to store rows which exist, they are valid until next request of the Store.
+     * In the manual commit mode, rows are got one by one in the transaction of this container
+     * so that its uncommitted updates are visible, and they are valid until next get_many
+     * @param *rowCount A pointer to store the number of rows
+     */
+    void Container::get_many(Field* keyList, size_t keyCount, GSRow* const** rowList, size_t* rowCount) {
+        assert(keyList != NULL || keyCount == 0);
+        assert(rowList != NULL);
+        assert(rowCount != NULL);
+        *rowList = NULL;
+        *rowCount = 0;
+        if (keyCount == 0) {
+            return;
+        }
+        if (!mAutoCommit) {
+            //Request by the Store does not see the transaction of this container
+            get_many_in_transaction(keyList, keyCount);
+            if (!mManyRowList.empty()) {
+                *rowList = &mManyRowList[0];
+                *rowCount = mManyRowList.size();
+            }
+            return;
+        }
+        if (mGridStore == NULL || mContainerInfo->name == NULL) {
+            throw GSException(mContainer, "Container is not opened by Store");
+        }
+
+        //Check type of row keys in the same way as get()
+        for (size_t i = 0; i < keyCount; i++) {
+            get_key_pointer(&keyList[i]);
+        }
+        GSType keyType = mContainerInfo->columnInfoList[0].type;
+        GSRowKeyPredicate* predicate;
+        GSResult ret = gsCreateRowKeyPredicate(mGridStore, keyType, &predicate);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mGridStore, ret);
+        }
+        for (size_t i = 0; i < keyCount; i++) {
+            ret = gsAddPredicateKeyGeneral(predicate, &keyList[i].value, keyType);
+            if (!GS_SUCCEEDED(ret)) {
+                GSException e(predicate, ret);
+                gsCloseRowKeyPredicate(&predicate);
+                throw GSException(&e);
+            }
+        }
+
+        GSRowKeyPredicateEntry entry = GS_ROW_KEY_PREDICATE_ENTRY_INITIALIZER;
+        entry.containerName = mContainerInfo->name;
+        entry.predicate = predicate;
+        const GSRowKeyPredicateEntry* entryList = &entry;
+        const GSContainerRowEntry* resultList = NULL;
+        size_t resultCount = 0;
+        ret = gsGetMultipleContainerRows(mGridStore, &entryList, 1, &resultList, &resultCount);
+        gsCloseRowKeyPredicate(&predicate);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mGridStore, ret);
+        }
+        if (resultCount > 0) {
+            *rowList = (GSRow* const*) resultList[0].rowList;
+            *rowCount = resultList[0].rowCount;
+        }
+    }
+
+    /**
+     * Get rows one by one by the container handle, they are kept in mManyRowList
+     */
+    void Container::get_many_in_transaction(Field* keyList, size_t keyCount) {
+        release_many_rows();
+        GSRow* row = NULL;
+        for (size_t i = 0; i < keyCount; i++) {
+            void *key = get_key_pointer(&keyList[i]);
+            GSResult ret;
+            if (row == NULL) {
+                ret = acquireRow(&row);
+                if (!GS_SUCCEEDED(ret)) {
+                    throw GSException(mContainer, ret);
+                }
+            }
+            GSBool exists;
+            ret = gsGetRow(mContainer, key, row, &exists);
+            if (!GS_SUCCEEDED(ret)) {
+                GSException e(mContainer, ret);
+                gsCloseRow(&row);
+                throw GSException(&e);
+            }
+            if (!exists) {
+                //Reuse the row for next key
+                continue;
+            }
+            try {
+                mManyRowList.push_back(row);
+            } catch (bad_alloc& ba) {
+                gsCloseRow(&row);
+                throw GSException(mContainer, "Memory allocation error");
+            }
+            row = NULL;
+        }
+        if (row != NULL) {
+            gsCloseRow(&row);
+        }
+    }
+
+    /**
+     * @brief Get rows corresponding to multiple row keys by one request, in the order of row keys
+     * @param *keyList The array of row keys
+     * @param keyCount The number of row keys
+     * @param *alignedRowList A pointer to store the row of each row key, NULL if it does not exist.
+     * Rows are valid until next request of the Store
+     */
+    void Container::get_many_aligned(Field* keyList, size_t keyCount, std::vector<GSRow*>* alignedRowList) {
+        assert(alignedRowList != NULL);
+        GSRow* const* rowList;
+        size_t rowCount;
+        get_many(keyList, keyCount, &rowList, &rowCount);
+
+        //Row keys are compared as converted by input typemap, so any form of timestamp matches
+        GSType keyType = mContainerInfo->columnInfoList[0].type;
+        try {
+            alignedRowList->assign(keyCount, NULL);
+            if (keyType == GS_TYPE_STRING) {
+                unordered_map<string, GSRow*> rowMap;
+                for (size_t i = 0; i < rowCount; i++) {
+                    const GSChar* key;
+                    GSResult ret = gsGetRowFieldAsString(rowList[i], 0, &key);
+                    if (!GS_SUCCEEDED(ret)) {
+                        throw GSException(rowList[i], ret);
+                    }
+                    rowMap[key] = rowList[i];
+                }
+                for (size_t i = 0; i < keyCount; i++) {
+                    unordered_map<string, GSRow*>::iterator it = rowMap.find(keyList[i].value.asString);
+                    if (it != rowMap.end()) {
+                        (*alignedRowList)[i] = it->second;
+                    }
+                }
+                return;
+            }
+            unordered_map<int64_t, GSRow*> rowMap;
+            for (size_t i = 0; i < rowCount; i++) {
+                int64_t key;
+                GSResult ret;
+                if (keyType == GS_TYPE_INTEGER) {
+                    int32_t value;
+                    ret = gsGetRowFieldAsInteger(rowList[i], 0, &value);
+                    key = value;
+                } else if (keyType == GS_TYPE_LONG) {
+                    ret = gsGetRowFieldAsLong(rowList[i], 0, &key);
+                } else {
+                    ret = gsGetRowFieldAsTimestamp(rowList[i], 0, &key);
+                }
+                if (!GS_SUCCEEDED(ret)) {
+                    throw GSException(rowList[i], ret);
+                }
+                rowMap[key] = rowList[i];
+            }
+            for (size_t i = 0; i < keyCount; i++) {
+                int64_t key;
+                if (keyType == GS_TYPE_INTEGER) {
+                    key = keyList[i].value.asInteger;
+                } else if (keyType == GS_TYPE_LONG) {
+                    key = keyList[i].value.asLong;
+                } else {
+                    key = keyList[i].value.asTimestamp;
+                }
+                unordered_map<int64_t, GSRow*>::iterator it = rowMap.find(key);
+                if (it != rowMap.end()) {
+                    (*alignedRowList)[i] = it->second;
+                }
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+    }
+
+    /**
+     * @brief Get rows corresponding to multiple row keys by one request into column oriented buffer
+     * @param *keyList The array of row keys
+     * @param keyCount The number of row keys
+     * @return A pointer stores values of rows which exist by column, need to be freed by caller
+     */
+    RowBatch* Container::get_many_columns(Field* keyList, size_t keyCount) {
+        GSRow* const* rowList;
+        size_t rowCount;
+        get_many(keyList, keyCount, &rowList, &rowCount);
+
+        RowBatch* batch;
+        try {
+            batch = new RowBatch(mContainerInfo->columnCount, mSchema->get_type_list());
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+        try {
+            for (size_t i = 0; i < rowCount; i++) {
+                batch->append(rowList[i]);
+            }
+        } catch (GSException& e) {
+            delete batch;
+            throw;
+        }
+        return batch;
+    }
+
     /**
      * @brief Put multi row data to database
      * @param **listRowdata The array of row to be put to data base
@@ -370,6 +830,9 @@ namespace griddb {
     void Container::multi_put(GSRow** listRowdata, int rowCount) {
         GSResult ret;
         GSBool bExists;
+        for (int i = 0; i < rowCount; i++) {
+            BlobCodec::encode_row(listRowdata[i], mCompressionList, mContainerInfo->columnCount);
+        }
         //data for each container
         ret = gsPutMultipleRows(mContainer, (const void * const *) listRowdata,
                 rowCount, &bExists);
@@ -390,8 +853,8 @@ namespace griddb {
      * @brief Get GSType of Container object to support put row
      * @return Return a pointer which store type the list of column of row in container
      */
-    GSType* Container::getGSTypeList(){
-        return mTypeList;
+    const GSType* Container::getGSTypeList(){
+        return mSchema->get_type_list();
     }
 
     /**
@@ -409,4 +872,139 @@ namespace griddb {
     int Container::getColumnCount(){
         return mContainerInfo->columnCount;
     }
+
+    /**
+     * @brief Get estimated memory size held by container object, it is used to bound container cache of Store
+     * @return Estimated size in bytes including rows kept for reuse and by get_many, and resources replaced by reset
+     */
+    size_t Container::get_memory_size() {
+        size_t size = sizeof(Container);
+        //Schema shared with other objects is counted for each container
+        size += mSchema->get_memory_size();
+        if (mCompressionList) {
+            size += mContainerInfo->columnCount * sizeof(int);
+        }
+        //Rows keep values written last, including variable length fields
+        size += RequestSplitter::estimate_row_size(mRow);
+        for (size_t i = 0; i < mRowPool.size(); i++) {
+            size += RequestSplitter::estimate_row_size(mRowPool[i]);
+        }
+        for (size_t i = 0; i < mManyRowList.size(); i++) {
+            size += RequestSplitter::estimate_row_size(mManyRowList[i]);
+        }
+        for (size_t i = 0; i < mRetiredList.size(); i++) {
+            const RetiredResource& retired = mRetiredList[i];
+            size += retired.schema->get_memory_size() + RequestSplitter::estimate_row_size(retired.row);
+            if (retired.compressionList) {
+                size += retired.schema->get_column_count() * sizeof(int);
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Set max number of rows kept for reuse by multi_put
+     * @param size Max number of rows, 0 disables reuse
+     */
+    void Container::set_row_pool_size(int size) {
+        if (size < 0) {
+            throw GSException(mContainer, "Row pool size must not be negative");
+        }
+        mRowPoolSize = size;
+        while ((int) mRowPool.size() > mRowPoolSize) {
+            gsCloseRow(&mRowPool.back());
+            mRowPool.pop_back();
+        }
+    }
+
+    /**
+     * @brief Get max number of rows kept for reuse by multi_put
+     * @return Max number of rows
+     */
+    int Container::get_row_pool_size() {
+        return mRowPoolSize;
+    }
+
+    /**
+     * @brief Get a row from pool, or create new row if pool is empty. Support multi_put
+     * @param **row The pointer to a pointer variable to store row
+     * @return Result of creating row
+     */
+    GSResult Container::acquireRow(GSRow** row) {
+        if (!mRowPool.empty()) {
+            *row = mRowPool.back();
+            mRowPool.pop_back();
+            return GS_RESULT_OK;
+        }
+        return gsCreateRowByContainer(mContainer, row);
+    }
+
+    /**
+     * @brief Return rows to pool and free row list. Rows over pool size or MAX_POOLED_ROW_SIZE are closed. Support multi_put
+     * @param **rowList List of rows got by acquireRow, NULL element is ignored
+     * @param rowCount Number of rows
+     */
+    void Container::releaseRowList(GSRow** rowList, int rowCount) {
+        if (rowList == NULL) {
+            return;
+        }
+        bool checkSize = has_variable_column();
+        for (int i = 0; i < rowCount; i++) {
+            if (rowList[i] != NULL) {
+                release_row(rowList[i], checkSize);
+            }
+        }
+        delete [] rowList;
+    }
+
+    /**
+     * Return rows got by get_many in the manual commit mode to pool
+     */
+    void Container::release_many_rows() {
+        bool checkSize = has_variable_column();
+        for (size_t i = 0; i < mManyRowList.size(); i++) {
+            release_row(mManyRowList[i], checkSize);
+        }
+        mManyRowList.clear();
+    }
+
+    /**
+     * Return row to pool, or close it if pool is full or it holds large values when checkSize is true
+     */
+    void Container::release_row(GSRow* row, bool checkSize) {
+        if ((int) mRowPool.size() < mRowPoolSize && mContainer != NULL &&
+                (!checkSize || RequestSplitter::estimate_row_size(row) <= MAX_POOLED_ROW_SIZE)) {
+            try {
+                mRowPool.push_back(row);
+                return;
+            } catch (bad_alloc& ba) {
+                //Close row below
+            }
+        }
+        gsCloseRow(&row);
+    }
+
+    /**
+     * Check whether size of rows depends on their values
+     */
+    bool Container::has_variable_column() {
+        for (size_t i = 0; i < mContainerInfo->columnCount; i++) {
+            GSType type = mContainerInfo->columnInfoList[i].type;
+            if (type == GS_TYPE_STRING || type == GS_TYPE_GEOMETRY || type == GS_TYPE_BLOB ||
+                    type >= GS_TYPE_STRING_ARRAY) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Close all rows in pool
+     */
+    void Container::clear_row_pool() {
+        for (size_t i = 0; i < mRowPool.size(); i++) {
+            gsCloseRow(&mRowPool[i]);
+        }
+        mRowPool.clear();
+    }
 }
@@ -18,11 +18,24 @@
 #define _CONTAINER_H_
 
 #include <assert.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
 
 #include "Field.h"
+#include "ContainerSchema.h"
 #include "Query.h"
+#include "PreparedQuery.h"
 #include "GSException.h"
 #include "Util.h"
+#include "BlobCodec.h"
+#include "BlobWriter.h"
+#include "BlobReader.h"
+
+//Default max number of GSRow kept for reuse by multi_put
+#define DEFAULT_ROW_POOL_SIZE 256
+//GSRow whose estimated size exceeds it is closed instead of being kept for reuse, since it keeps values written last
+#define MAX_POOLED_ROW_SIZE 4096
 
 using namespace std;
 
@@ -30,13 +43,33 @@ namespace griddb {
 
 class Container {
 
-    GSContainerInfo* mContainerInfo;
     GSContainer *mContainer;
+    //Store which opened this container, used for requests over multiple rows such as get_many
+    GSGridStore* mGridStore;
+    //Schema shared with Query, RowSet and ContainerInfo, mContainerInfo refers to it
+    ContainerSchemaPtr mSchema;
+    const GSContainerInfo* mContainerInfo;
 
     friend class Store;
 
     GSRow* mRow;
-    GSType* mTypeList;
+    int* mCompressionList;
+    //GSRow objects reused by multi_put, every field is overwritten when reused
+    vector<GSRow*> mRowPool;
+    int mRowPoolSize;
+    //Resources replaced when schema is reloaded, Query and RowSet created before may still use them.
+    //They share schema with the resources, so the resources are released when only this list refers to the schema.
+    struct RetiredResource {
+        GSContainer* container;
+        GSRow* row;
+        int* compressionList;
+        ContainerSchemaPtr schema;
+    };
+    vector<RetiredResource> mRetiredList;
+    //Commit mode set by set_auto_commit, it is applied to the handle reopened by reset
+    bool mAutoCommit;
+    //Rows got by get_many in the manual commit mode, valid until next get_many
+    vector<GSRow*> mManyRowList;
 
     public:
         bool timestamp_output_with_float;
@@ -47,21 +80,45 @@ class Container {
         void drop_index(const char* column_name, GSIndexTypeFlags index_type = GS_INDEX_FLAG_DEFAULT, const char* name=NULL);
         bool put(GSRow *row);
         Query* query(const char *query);
+        PreparedQuery* prepare(const char *query);
         void abort();
         void flush();
         void set_auto_commit(bool enabled);
         void commit();
         GSBool get(Field* keyFields, GSRow *rowdata);
         bool remove(Field* keyFields);
+        int64_t multi_remove(Field* keyList, size_t keyCount);
+        void get_many(Field* keyList, size_t keyCount, GSRow* const** rowList, size_t* rowCount);
+        RowBatch* get_many_columns(Field* keyList, size_t keyCount);
+        void get_many_aligned(Field* keyList, size_t keyCount, std::vector<GSRow*>* alignedRowList);
         void multi_put(GSRow** listRowdata, int rowCount);
+        BlobWriter* create_blob_writer(int column, size_t expected_size = 0);
+        bool put_blob(Field* keyFields, BlobWriter* writer);
+        BlobReader* get_blob_reader(Field* keyFields, int column);
+        size_t get_memory_size();
+        void set_row_pool_size(int size);
+        int get_row_pool_size();
         GSContainer* getGSContainerPtr();
-        GSType* getGSTypeList();
+        const GSType* getGSTypeList();
         int getColumnCount();
         GSRow* getGSRowPtr();
+        GSResult acquireRow(GSRow** row);
+        void releaseRowList(GSRow** rowList, int rowCount);
 
     private:
-        Container(GSContainer *container, GSContainerInfo* containerInfo);
+        Container(GSContainer *container, const ContainerSchemaPtr& schema, GSGridStore* store = NULL);
         void freeMemoryContainer();
+        void set_compression_list(const int* compressionList);
+        void* get_key_pointer(Field* keyFields);
+        void check_blob_column(int column);
+        void clear_row_pool();
+        void reset(GSContainer* container, const ContainerSchemaPtr& schema);
+        int* remap_compression_list(const GSContainerInfo* info);
+        void release_retired_resources(bool all, GSBool allRelated = GS_FALSE);
+        void get_many_in_transaction(Field* keyList, size_t keyCount);
+        void release_many_rows();
+        void release_row(GSRow* row, bool checkSize);
+        bool has_variable_column();
 };
 
 } /* namespace griddb */
@@ -24,6 +24,27 @@ namespace griddb {
      */
     ContainerInfo::ContainerInfo(GSContainerInfo *containerInfo) {
         assert(containerInfo != NULL);
+        copy(containerInfo);
+    }
+
+    /**
+     * @brief Constructor a new ContainerInfo::ContainerInfo object which refers to shared schema.
+     * Schema is copied only when any attribute is changed.
+     * @param schema Schema of a specific Container
+     */
+    ContainerInfo::ContainerInfo(const ContainerSchemaPtr& schema) : mSchema(schema),
+            mExpInfo(NULL) {
+        assert(schema);
+        GSContainerInfo containerInfo = GS_CONTAINER_INFO_INITIALIZER;
+        mContainerInfo = containerInfo;
+        mColumnInfoList.columnInfo = NULL;
+        mColumnInfoList.size = 0;
+    }
+
+    /**
+     * Copy all attributes of container information
+     */
+    void ContainerInfo::copy(const GSContainerInfo* containerInfo) {
         init(containerInfo->name, containerInfo->type,
                 containerInfo->columnInfoList, containerInfo->columnCount,
                 containerInfo->rowKeyAssigned, NULL);
@@ -195,6 +216,7 @@ namespace griddb {
      * @param *containerName Stores the name of Container
      */
     void ContainerInfo::set_name(GSChar* containerName) {
+        detach();
         if (mContainerInfo.name) {
             delete[] mContainerInfo.name;
         }
@@ -214,6 +236,7 @@ namespace griddb {
      * @param containerType The type of Container
      */
     void ContainerInfo::set_type(GSContainerType containerType) {
+        detach();
         mContainerInfo.type = containerType;
     }
 
@@ -222,6 +245,7 @@ namespace griddb {
      * @param rowKeyAssigned The boolean value indicating whether the Row key Column is assigned
      */
     void ContainerInfo::set_row_key_assigned(bool rowKeyAssigned) {
+        detach();
         mContainerInfo.rowKeyAssigned = rowKeyAssigned;
     }
 
@@ -230,7 +254,7 @@ namespace griddb {
      * @return The name of Container
      */
     const GSChar* ContainerInfo::get_name() {
-        return mContainerInfo.name;
+        return info()->name;
     }
 
     /**
@@ -238,7 +262,7 @@ namespace griddb {
      * @return The type of Container
      */
     GSContainerType ContainerInfo::get_type() {
-        return mContainerInfo.type;
+        return info()->type;
     }
 
     /**
@@ -247,10 +271,11 @@ namespace griddb {
      * @return The information of column which is stored in ContainerInfo
      */
     GSColumnInfo ContainerInfo::get_column_info(size_t column) {
-        if (column >= mContainerInfo.columnCount) {
+        const GSContainerInfo* containerInfo = info();
+        if (column >= containerInfo->columnCount) {
             throw GSException("Index out of bound error");
         }
-        return mContainerInfo.columnInfoList[column];
+        return containerInfo->columnInfoList[column];
     }
 
     /**
@@ -258,7 +283,60 @@ namespace griddb {
      * @return The boolean value indicating whether the Row key Column is assigned
      */
     bool ContainerInfo::get_row_key_assigned() {
-        return mContainerInfo.rowKeyAssigned;
+        return info()->rowKeyAssigned;
+    }
+
+    /**
+     * @brief Set client side compression type for BLOB column
+     * @param column The number of column
+     * @param compressionType The compression type
+     */
+    void ContainerInfo::set_column_compression(int column, int compressionType) {
+        const GSContainerInfo* containerInfo = info();
+        if (column < 0 || column >= containerInfo->columnCount) {
+            throw GSException("Index out of bound error");
+        }
+        if (!BlobCodec::is_valid_type(compressionType)) {
+            throw GSException("Invalid compression type");
+        }
+        if (compressionType != CompressionType::NONE &&
+                containerInfo->columnInfoList[column].type != GS_TYPE_BLOB) {
+            throw GSException("Compression can be set only for BLOB column");
+        }
+        try {
+            mCompressionList.resize(containerInfo->columnCount, (int) CompressionType::NONE);
+        } catch (bad_alloc& ba) {
+            throw GSException("Memory allocation error");
+        }
+        mCompressionList[column] = compressionType;
+    }
+
+    /**
+     * @brief Get client side compression type of column
+     * @param column The number of column
+     * @return The compression type
+     */
+    int ContainerInfo::get_column_compression(int column) {
+        if (column < 0 || column >= info()->columnCount) {
+            throw GSException("Index out of bound error");
+        }
+        if (mCompressionList.empty()) {
+            return CompressionType::NONE;
+        }
+        return mCompressionList[column];
+    }
+
+    /**
+     * @brief Get client side compression type of all columns
+     * @return A list has columnCount elements, NULL if no column is compressed
+     */
+    const int* ContainerInfo::get_compression_list() {
+        for (size_t i = 0; i < mCompressionList.size(); i++) {
+            if (mCompressionList[i] != CompressionType::NONE) {
+                return &mCompressionList[0];
+            }
+        }
+        return NULL;
     }
 
     /**
@@ -266,14 +344,50 @@ namespace griddb {
      * @return A pointer which store all information of Container
      */
     GSContainerInfo* ContainerInfo::gs_info() {
+        detach();
         return &mContainerInfo;
     }
 
+    /**
+     * @brief Get schema of Container which can be shared with Container object
+     * @return Shared schema, it is created from current attributes if any attribute was changed
+     */
+    ContainerSchemaPtr ContainerInfo::get_schema() {
+        if (mSchema) {
+            return mSchema;
+        }
+        return ContainerSchema::create(&mContainerInfo);
+    }
+
+    /**
+     * Get container information to read, shared schema is used if it is not detached
+     */
+    const GSContainerInfo* ContainerInfo::info() {
+        if (mSchema) {
+            return mSchema->gs_info();
+        }
+        return &mContainerInfo;
+    }
+
+    /**
+     * Copy shared schema to own container information before it is changed
+     */
+    void ContainerInfo::detach() {
+        if (!mSchema) {
+            return;
+        }
+        ExpirationInfo* expInfo = mExpInfo;
+        copy(mSchema->gs_info());
+        mExpInfo = expInfo;
+        mSchema.reset();
+    }
+
     /**
      *  @brief Set information of column stored in ContainerInfo
      *  @param columnInfoList A struct which store information of column
      */
     void ContainerInfo::set_column_info_list(ColumnInfoList columnInfoList) {
+        detach();
         //Free current stored ColumnInfo list
         if (mContainerInfo.columnInfoList) {
             //Free memory of columns name
@@ -285,6 +399,7 @@ namespace griddb {
 
         mContainerInfo.columnCount = columnInfoList.size;
         mContainerInfo.columnInfoList = NULL;
+        mCompressionList.clear();
 
         if (columnInfoList.size == 0 || columnInfoList.columnInfo == NULL) {
             return;
@@ -321,8 +436,9 @@ namespace griddb {
      *  @return A struct which store information of column
      */
     ColumnInfoList ContainerInfo::get_column_info_list() {
-        mColumnInfoList.columnInfo = (GSColumnInfo*) mContainerInfo.columnInfoList;
-        mColumnInfoList.size = mContainerInfo.columnCount;
+        const GSContainerInfo* containerInfo = info();
+        mColumnInfoList.columnInfo = (GSColumnInfo*) containerInfo->columnInfoList;
+        mColumnInfoList.size = containerInfo->columnCount;
         return mColumnInfoList;
     }
 
@@ -331,6 +447,7 @@ namespace griddb {
      *  @param *expirationInfo A ExpirationInfo object which store the information about optional configuration settings used for newly creating or updating a TimeSeries
      */
     void ContainerInfo::set_expiration_info(ExpirationInfo* expirationInfo) {
+        detach();
         if (mContainerInfo.timeSeriesProperties != NULL) {
             delete mContainerInfo.timeSeriesProperties;
             mContainerInfo.timeSeriesProperties = NULL;
@@ -354,16 +471,17 @@ namespace griddb {
      *  @return A ExpirationInfo object which store the information about optional configuration settings used for newly creating or updating a TimeSeries
      */
     ExpirationInfo* ContainerInfo::get_expiration_info() {
-        if (mContainerInfo.timeSeriesProperties != NULL){
+        const GSTimeSeriesProperties* timeSeriesProperties = info()->timeSeriesProperties;
+        if (timeSeriesProperties != NULL){
             if (mExpInfo != NULL) {
-                mExpInfo->set_time(mContainerInfo.timeSeriesProperties->rowExpirationTime);
-                mExpInfo->set_time_unit(mContainerInfo.timeSeriesProperties->rowExpirationTimeUnit);
-                mExpInfo->set_division_count(mContainerInfo.timeSeriesProperties->expirationDivisionCount);
+                mExpInfo->set_time(timeSeriesProperties->rowExpirationTime);
+                mExpInfo->set_time_unit(timeSeriesProperties->rowExpirationTimeUnit);
+                mExpInfo->set_division_count(timeSeriesProperties->expirationDivisionCount);
             } else {
                 try {
-                    mExpInfo = new ExpirationInfo(mContainerInfo.timeSeriesProperties->rowExpirationTime,
-                            mContainerInfo.timeSeriesProperties->rowExpirationTimeUnit,
-                            mContainerInfo.timeSeriesProperties->expirationDivisionCount);
+                    mExpInfo = new ExpirationInfo(timeSeriesProperties->rowExpirationTime,
+                            timeSeriesProperties->rowExpirationTimeUnit,
+                            timeSeriesProperties->expirationDivisionCount);
                 } catch (bad_alloc& ba) {
                     throw GSException("Memory allocation error");
                 }
@@ -20,12 +20,15 @@
 #include <string>
 #include <cstring>
 #include <utility>
+#include <vector>
 #include <assert.h>
 
 #include "TimeSeriesProperties.h"
 #include "ExpirationInfo.h"
 #include "GSException.h"
 #include "Util.h"
+#include "BlobCodec.h"
+#include "ContainerSchema.h"
 
 //Support column_info_list attribute
 struct ColumnInfoList {
@@ -44,14 +47,21 @@ class ContainerInfo {
     private:
         GSContainerInfo mContainerInfo;
 
+        //Shared schema which is used instead of mContainerInfo until any attribute is changed
+        ContainerSchemaPtr mSchema;
+
         //tmp attribute to get column info list
         ColumnInfoList mColumnInfoList;
 
         //tmp attribute support get expiration attribute
         ExpirationInfo* mExpInfo;
 
+        //Client side compression type of each column
+        vector<int> mCompressionList;
+
     public:
         ContainerInfo(GSContainerInfo *containerInfo);
+        ContainerInfo(const ContainerSchemaPtr& schema);
         ContainerInfo(const GSChar* name, const GSColumnInfo* props,
                 int propsCount, GSContainerType type = GS_CONTAINER_COLLECTION,
                 bool row_key = true, ExpirationInfo* expiration = NULL);
@@ -68,9 +78,16 @@ class ContainerInfo {
         ExpirationInfo* get_expiration_info();
         void set_expiration_info(ExpirationInfo* expirationInfo);
         bool get_row_key_assigned();
+        void set_column_compression(int column, int compressionType);
+        int get_column_compression(int column);
+        const int* get_compression_list();
         GSContainerInfo* gs_info();
+        ContainerSchemaPtr get_schema();
 
     private:
+        void copy(const GSContainerInfo* containerInfo);
+        const GSContainerInfo* info();
+        void detach();
         void init(const GSChar* name, GSContainerType type, const GSColumnInfo* props,
                 int propsCount, bool rowKeyAssigned, ExpirationInfo* expiration);
 };
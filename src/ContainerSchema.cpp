@@ -0,0 +1,164 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include "ContainerSchema.h"
+
+namespace griddb {
+
+    /**
+     * Copy container information, bad_alloc is thrown if memory allocation fails
+     */
+    ContainerSchema::ContainerSchema(const GSContainerInfo* containerInfo) :
+            mContainerInfo(*containerInfo) {
+        size_t columnCount = containerInfo->columnCount;
+        size_t bufferSize = 0;
+        if (containerInfo->name) {
+            bufferSize += strlen(containerInfo->name) + 1;
+        }
+        if (containerInfo->dataAffinity) {
+            bufferSize += strlen(containerInfo->dataAffinity) + 1;
+        }
+        for (size_t i = 0; i < columnCount; i++) {
+            if (containerInfo->columnInfoList[i].name) {
+                bufferSize += strlen(containerInfo->columnInfoList[i].name) + 1;
+            }
+        }
+        mNameBuffer.resize(bufferSize);
+        mColumnInfoList.resize(columnCount);
+        mTypeList.resize(columnCount);
+
+        //Pointers refer to mNameBuffer, it is not reallocated after this point
+        GSChar* pos = mNameBuffer.empty() ? NULL : &mNameBuffer[0];
+        mContainerInfo.name = NULL;
+        if (containerInfo->name) {
+            size_t size = strlen(containerInfo->name) + 1;
+            memcpy(pos, containerInfo->name, size);
+            mContainerInfo.name = pos;
+            pos += size;
+        }
+        mContainerInfo.dataAffinity = NULL;
+        if (containerInfo->dataAffinity) {
+            size_t size = strlen(containerInfo->dataAffinity) + 1;
+            memcpy(pos, containerInfo->dataAffinity, size);
+            mContainerInfo.dataAffinity = pos;
+            pos += size;
+        }
+        for (size_t i = 0; i < columnCount; i++) {
+            mColumnInfoList[i] = containerInfo->columnInfoList[i];
+            mColumnInfoList[i].name = NULL;
+            if (containerInfo->columnInfoList[i].name) {
+                size_t size = strlen(containerInfo->columnInfoList[i].name) + 1;
+                memcpy(pos, containerInfo->columnInfoList[i].name, size);
+                mColumnInfoList[i].name = pos;
+                pos += size;
+            }
+            mTypeList[i] = containerInfo->columnInfoList[i].type;
+        }
+        mContainerInfo.columnInfoList = columnCount > 0 ? &mColumnInfoList[0] : NULL;
+
+        mContainerInfo.timeSeriesProperties = NULL;
+        if (containerInfo->timeSeriesProperties) {
+            mTimeSeriesProperties = *containerInfo->timeSeriesProperties;
+            mContainerInfo.timeSeriesProperties = &mTimeSeriesProperties;
+        }
+        //Same as ContainerInfo, only the first trigger is kept
+        mContainerInfo.triggerInfoList = NULL;
+        if (containerInfo->triggerInfoList) {
+            mTriggerInfo = *containerInfo->triggerInfoList;
+            mContainerInfo.triggerInfoList = &mTriggerInfo;
+        }
+    }
+
+    /**
+     * @brief Create shared schema from container information
+     * @param *containerInfo Container information, it is copied so that it can be released after this call
+     * @return Shared pointer of schema
+     */
+    ContainerSchemaPtr ContainerSchema::create(const GSContainerInfo* containerInfo) {
+        if (containerInfo == NULL) {
+            throw GSException("Container info can not be null");
+        }
+        try {
+            return ContainerSchemaPtr(new ContainerSchema(containerInfo));
+        } catch (bad_alloc& ba) {
+            throw GSException("Memory allocation error");
+        }
+    }
+
+    /**
+     * @brief Get container information
+     * @return A pointer which is valid while the schema is alive
+     */
+    const GSContainerInfo* ContainerSchema::gs_info() const {
+        return &mContainerInfo;
+    }
+
+    /**
+     * @brief Get type of each column
+     * @return A list has column count elements
+     */
+    const GSType* ContainerSchema::get_type_list() const {
+        return mTypeList.empty() ? NULL : &mTypeList[0];
+    }
+
+    /**
+     * @brief Get number of columns
+     * @return Number of columns
+     */
+    int ContainerSchema::get_column_count() const {
+        return (int) mContainerInfo.columnCount;
+    }
+
+    /**
+     * @brief Get estimated memory size held by schema
+     * @return Size in bytes
+     */
+    size_t ContainerSchema::get_memory_size() const {
+        return sizeof(ContainerSchema) + mNameBuffer.size() +
+                mColumnInfoList.size() * (sizeof(GSColumnInfo) + sizeof(GSType));
+    }
+
+    /**
+     * @brief Check row layout is same, it is used to detect schema change
+     * @param schema Schema to compare
+     * @return True if container type, row key and name, type and options of all columns are same
+     */
+    bool ContainerSchema::has_same_columns(const ContainerSchema& schema) const {
+        const GSContainerInfo* other = schema.gs_info();
+        if (mContainerInfo.type != other->type ||
+                (mContainerInfo.rowKeyAssigned != GS_FALSE) != (other->rowKeyAssigned != GS_FALSE) ||
+                mContainerInfo.columnCount != other->columnCount) {
+            return false;
+        }
+        for (size_t i = 0; i < mContainerInfo.columnCount; i++) {
+            const GSColumnInfo& column = mContainerInfo.columnInfoList[i];
+            const GSColumnInfo& otherColumn = other->columnInfoList[i];
+            if (column.type != otherColumn.type || column.options != otherColumn.options) {
+                return false;
+            }
+            if (column.name == NULL || otherColumn.name == NULL) {
+                if (column.name != otherColumn.name) {
+                    return false;
+                }
+            } else if (Util::to_lower(column.name) != Util::to_lower(otherColumn.name)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} /* namespace griddb */
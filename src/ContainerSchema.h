@@ -0,0 +1,65 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#ifndef _CONTAINER_SCHEMA_H_
+#define _CONTAINER_SCHEMA_H_
+
+#include <memory>
+#include <string.h>
+#include <vector>
+
+#include "gridstore.h"
+#include "GSException.h"
+#include "Util.h"
+
+using namespace std;
+
+namespace griddb {
+
+class ContainerSchema;
+typedef shared_ptr<const ContainerSchema> ContainerSchemaPtr;
+
+/**
+ * Immutable copy of container information which is shared by Container, Query, RowSet and ContainerInfo.
+ * Container name, data affinity and column names are stored in one buffer.
+ */
+class ContainerSchema {
+    GSContainerInfo mContainerInfo;
+    GSTimeSeriesProperties mTimeSeriesProperties;
+    GSTriggerInfo mTriggerInfo;
+    vector<GSColumnInfo> mColumnInfoList;
+    vector<GSType> mTypeList;
+    vector<GSChar> mNameBuffer;
+
+    public:
+        static ContainerSchemaPtr create(const GSContainerInfo* containerInfo);
+
+        const GSContainerInfo* gs_info() const;
+        const GSType* get_type_list() const;
+        int get_column_count() const;
+        size_t get_memory_size() const;
+        bool has_same_columns(const ContainerSchema& schema) const;
+
+    private:
+        ContainerSchema(const GSContainerInfo* containerInfo);
+        ContainerSchema(const ContainerSchema&);
+        ContainerSchema& operator=(const ContainerSchema&);
+};
+
+} /* namespace griddb */
+
+#endif /* _CONTAINER_SCHEMA_H_ */
@@ -100,6 +100,12 @@ class TypeOption {
         static const int NULLABLE = 1 << 1;
         static const int NOT_NULL = 1 << 2;
 };
+// Represents the type(s) of compression applied to BLOB column on client side.
+class CompressionType {
+    public:
+        static const int NONE = 0;
+        static const int LZ4 = 1;
+};
 }
 
 #endif
@@ -18,12 +18,38 @@
 
 namespace griddb {
 
+    struct Crc32Table {
+        uint32_t value[256];
+        Crc32Table() {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+                }
+                value[i] = c;
+            }
+        }
+    };
+    static const Crc32Table CRC32_TABLE;
+
+    /**
+     * CRC32 of container name, ASCII uppercase characters are treated as lowercase
+     */
+    static uint32_t crc32_lower(const GSChar* str) {
+        uint32_t crc = 0xFFFFFFFFU;
+        for (const unsigned char* p = (const unsigned char*) str; *p != '\0'; p++) {
+            unsigned char c = (*p >= 'A' && *p <= 'Z') ? (*p - 'A' + 'a') : *p;
+            crc = CRC32_TABLE.value[(crc ^ c) & 0xFF] ^ (crc >> 8);
+        }
+        return crc ^ 0xFFFFFFFFU;
+    }
+
     /**
      * @brief Constructor a new PartitionController::PartitionController object
      * @param *controller A pointer for acquiring and processing the partition status
      */
     PartitionController::PartitionController(GSPartitionController *controller) :
-        mController(controller) {
+        mController(controller), mPartitionCount(-1), mLocalHashState(-1) {
     }
 
     /**
@@ -48,6 +74,9 @@ namespace griddb {
      * @return The number of partitions in the target GridDB cluster
      */
     int32_t PartitionController::get_partition_count() {
+        if (mPartitionCount >= 0) {
+            return mPartitionCount;
+        }
         int32_t value;
         GSResult ret = gsGetPartitionCount(mController, &value);
 
@@ -55,6 +84,7 @@ namespace griddb {
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mController, ret);
         }
+        mPartitionCount = value;
         return value;
     }
 
@@ -97,12 +127,44 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Get address of the node which owns a specified partition.
+     * @param partition_index The partition index, from 0 to the number of partitions minus one
+     * @return Address of owner node, empty if the owner is unknown
+     */
+    string PartitionController::get_owner_host(int32_t partition_index) {
+        const GSChar* address = NULL;
+        GSResult ret = gsGetPartitionOwnerHost(mController, partition_index, &address);
+
+        // Check ret, if error, throw exception
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mController, ret);
+        }
+        try {
+            return (address == NULL) ? string() : string(address);
+        } catch (bad_alloc& ba) {
+            throw GSException(mController, "Memory allocation error");
+        }
+    }
+
     /**
      * @brief Get the partition index corresponding to the specified Container name.
      * @param *container_name Container name
      * @return The partition index
      */
     int32_t PartitionController::get_partition_index_of_container(const GSChar* container_name) {
+        string key;
+        if (container_name != NULL) {
+            try {
+                key = Util::to_lower(container_name);
+            } catch (bad_alloc& ba) {
+                throw GSException(mController, "Memory allocation error");
+            }
+            map<string, int32_t>::iterator it = mPartitionIndexMap.find(key);
+            if (it != mPartitionIndexMap.end()) {
+                return it->second;
+            }
+        }
         int32_t value;
         GSResult ret = gsGetPartitionIndexOfContainer(mController, container_name, &value);
 
@@ -110,7 +172,70 @@ namespace griddb {
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mController, ret);
         }
+        if (container_name != NULL) {
+            try {
+                mPartitionIndexMap[key] = value;
+            } catch (bad_alloc& ba) {
+                //Memoization is optional
+            }
+        }
         return value;
     }
 
+    /**
+     * @brief Get the partition index corresponding to the specified Container name without inquiry to cluster if possible.
+     * The index is computed locally when the hashing scheme of cluster has been verified by sample container names,
+     * otherwise it is same as get_partition_index_of_container.
+     * @param *container_name Container name
+     * @return The partition index
+     */
+    int32_t PartitionController::partition_of(const GSChar* container_name) {
+        int32_t value;
+        if (calc_partition_index(container_name, &value)) {
+            return value;
+        }
+        return get_partition_index_of_container(container_name);
+    }
+
+    /**
+     * Compute partition index by CRC32 of lowercase container name as GridDB cluster does.
+     * Return false if it is not verified or container name has node affinity.
+     */
+    bool PartitionController::calc_partition_index(const GSChar* container_name, int32_t* partitionIndex) {
+        if (container_name == NULL || strchr(container_name, '@') != NULL ||
+                strchr(container_name, '/') != NULL) {
+            return false;
+        }
+        if (mLocalHashState < 0) {
+            mLocalHashState = verify_local_hash() ? 1 : 0;
+        }
+        if (mLocalHashState == 0) {
+            return false;
+        }
+        *partitionIndex = (int32_t) (crc32_lower(container_name) % (uint32_t) mPartitionCount);
+        return true;
+    }
+
+    /**
+     * Compare local computation with partition index got from cluster for sample container names
+     */
+    bool PartitionController::verify_local_hash() {
+        if (get_partition_count() <= 0) {
+            return false;
+        }
+        char name[32];
+        for (int i = 0; i < PARTITION_SAMPLE_COUNT; i++) {
+            sprintf(name, "PartitionSample_%d", i);
+            int32_t value;
+            GSResult ret = gsGetPartitionIndexOfContainer(mController, name, &value);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(mController, ret);
+            }
+            if ((int32_t) (crc32_lower(name) % (uint32_t) mPartitionCount) != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
 } /* namespace griddb */
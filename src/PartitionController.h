@@ -17,8 +17,18 @@
 #ifndef _PARTITIONCONTROLLER_H_
 #define _PARTITIONCONTROLLER_H_
 
+#include <stdio.h>
+#include <map>
+#include <string>
+
 #include "gridstore.h"
 #include "GSException.h"
+#include "Util.h"
+
+//Number of sample container names to verify local partition index computation
+#define PARTITION_SAMPLE_COUNT 16
+
+using namespace std;
 
 namespace griddb {
 
@@ -28,6 +38,13 @@ class PartitionController {
     private:
         GSPartitionController *mController;
 
+        //Partition count and partition index of each container never change while cluster is running,
+        //key of mPartitionIndexMap is lowercase container name
+        int32_t mPartitionCount;
+        map<string, int32_t> mPartitionIndexMap;
+        //-1: not verified yet, 0: local computation does not match server, 1: local computation is available
+        int mLocalHashState;
+
     public:
         ~PartitionController();
         void close();
@@ -36,9 +53,13 @@ class PartitionController {
         void get_container_names(int32_t partition_index, int64_t start,
                 const GSChar * const ** stringList, size_t *size, int64_t limit = -1);
         int32_t get_partition_index_of_container(const GSChar *container_name);
+        int32_t partition_of(const GSChar *container_name);
+        string get_owner_host(int32_t partition_index);
 
     private:
         PartitionController(GSPartitionController *controller);
+        bool calc_partition_index(const GSChar *container_name, int32_t* partitionIndex);
+        bool verify_local_hash();
 };
 
 } /* namespace griddb */
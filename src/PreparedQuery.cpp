@@ -0,0 +1,212 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include "PreparedQuery.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <inttypes.h>
+
+namespace griddb {
+
+    /**
+     * @brief Constructor a new PreparedQuery::PreparedQuery object
+     * @param *container A pointer holding the information about a specific GSContainer
+     * @param schema Schema of the container, it is shared with RowSet objects created by this query
+     * @param *gsRow A pointer holding the information about a row related to a specific GSContainer
+     * @param *compressionList Client side compression type of each column, NULL means no compression
+     */
+    PreparedQuery::PreparedQuery(GSContainer *container, const ContainerSchemaPtr& schema, GSRow *gsRow,
+            const int* compressionList) : mContainer(container), mSchema(schema),
+            mRow(gsRow), mCompressionList(compressionList), mParameterCount(0) {
+    }
+
+    PreparedQuery::~PreparedQuery() {
+        close();
+    }
+
+    /**
+     * @brief Release PreparedQuery resource
+     */
+    void PreparedQuery::close() {
+        mContainer = NULL;
+        mSegmentList.clear();
+        mParameterIndexList.clear();
+        mParameterCount = 0;
+    }
+
+    /**
+     * @brief Get number of parameters
+     * @return The largest parameter number used in statement
+     */
+    int PreparedQuery::get_parameter_count() {
+        return mParameterCount;
+    }
+
+    /**
+     * @brief Build TQL statement from bound values, execute it and fetch the result
+     * @param *parameterList Values of parameters, parameterList[0] is bound to ?1
+     * @param parameterCount Number of values, it must not be less than number of parameters
+     * @param for_update Indicates whether it requests a lock for update or not
+     * @return RowSet of the result, it closes the query when it is closed
+     */
+    RowSet* PreparedQuery::execute(Field* parameterList, int parameterCount, bool for_update) {
+        if (mContainer == NULL) {
+            throw GSException("PreparedQuery is already closed");
+        }
+        if (parameterCount < mParameterCount) {
+            throw GSException("Number of values is less than number of parameters");
+        }
+        try {
+            mStatement.clear();
+            for (size_t i = 0; i < mParameterIndexList.size(); i++) {
+                mStatement.append(mSegmentList[i]);
+                append_parameter(parameterList[mParameterIndexList[i]]);
+            }
+            mStatement.append(mSegmentList.back());
+        } catch (bad_alloc& ba) {
+            throw GSException(mContainer, "Memory allocation error");
+        }
+
+        GSQuery *pQuery;
+        GSResult ret = gsQuery(mContainer, mStatement.c_str(), &pQuery);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mContainer, ret);
+        }
+        GSRowSet *gsRowSet;
+        ret = gsFetch(pQuery, (for_update == true ? GS_TRUE:GS_FALSE), &gsRowSet);
+        if (!GS_SUCCEEDED(ret)) {
+            //Keep error information before closing query
+            GSException exception(pQuery, ret);
+            gsCloseQuery(&pQuery);
+            throw GSException(&exception);
+        }
+
+        try {
+            RowSet* rowset = new RowSet(gsRowSet, mSchema, mRow, mCompressionList);
+            rowset->mQuery = pQuery;
+            return rowset;
+        } catch (bad_alloc& ba) {
+            gsCloseRowSet(&gsRowSet);
+            gsCloseQuery(&pQuery);
+            throw GSException(mContainer, "Memory allocation error");
+        }
+    }
+
+    /**
+     * Split statement into literal parts and parameters ?1, ?2, ...
+     * "?" in string literal or quoted name is not a parameter.
+     */
+    void PreparedQuery::parse(const char* query) {
+        if (query == NULL) {
+            throw GSException("Query is NULL");
+        }
+        string segment;
+        const char* p = query;
+        char quote = '\0';
+        while (*p != '\0') {
+            char c = *p;
+            if (quote != '\0') {
+                segment.push_back(c);
+                p++;
+                if (c == quote) {
+                    //'' and "" are escaped quote in quoted part
+                    if (*p == quote) {
+                        segment.push_back(*p);
+                        p++;
+                    } else {
+                        quote = '\0';
+                    }
+                }
+                continue;
+            }
+            if (c == '\'' || c == '"') {
+                quote = c;
+            } else if (c == '?' && p[1] >= '1' && p[1] <= '9') {
+                int index = 0;
+                p++;
+                while (*p >= '0' && *p <= '9') {
+                    index = index * 10 + (*p - '0');
+                    if (index > 65535) {
+                        throw GSException("Parameter number is too large");
+                    }
+                    p++;
+                }
+                mSegmentList.push_back(segment);
+                mParameterIndexList.push_back(index - 1);
+                if (index > mParameterCount) {
+                    mParameterCount = index;
+                }
+                segment.clear();
+                continue;
+            }
+            segment.push_back(c);
+            p++;
+        }
+        mSegmentList.push_back(segment);
+    }
+
+    /**
+     * Append a bound value as TQL literal
+     */
+    void PreparedQuery::append_parameter(const Field& field) {
+        char buffer[32];
+        switch (field.type) {
+        case GS_TYPE_NULL:
+            mStatement.append("NULL");
+            break;
+        case GS_TYPE_BOOL:
+            mStatement.append(field.value.asBool ? "TRUE" : "FALSE");
+            break;
+        case GS_TYPE_LONG:
+            sprintf(buffer, "%" PRId64, field.value.asLong);
+            mStatement.append(buffer);
+            break;
+        case GS_TYPE_DOUBLE:
+            if (isnan(field.value.asDouble) || isinf(field.value.asDouble)) {
+                throw GSException("NaN and Infinity can not be bound to parameter");
+            }
+            //Use shortest representation which is converted back to the same value
+            sprintf(buffer, "%.15g", field.value.asDouble);
+            if (strtod(buffer, NULL) != field.value.asDouble) {
+                sprintf(buffer, "%.17g", field.value.asDouble);
+            }
+            mStatement.append(buffer);
+            break;
+        case GS_TYPE_TIMESTAMP:
+            sprintf(buffer, "TO_TIMESTAMP_MS(%" PRId64 ")", field.value.asTimestamp);
+            mStatement.append(buffer);
+            break;
+        case GS_TYPE_STRING: {
+            const GSChar* str = field.value.asString;
+            mStatement.push_back('\'');
+            for (; str != NULL && *str != '\0'; str++) {
+                if (*str == '\'') {
+                    mStatement.push_back('\'');
+                }
+                mStatement.push_back(*str);
+            }
+            mStatement.push_back('\'');
+            break;
+        }
+        default:
+            throw GSException("Type of value is not supported for parameter");
+        }
+    }
+
+} /* namespace griddb */
@@ -0,0 +1,68 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#ifndef _PREPARED_QUERY_H_
+#define _PREPARED_QUERY_H_
+
+#include <string>
+#include <vector>
+
+#include "gridstore.h"
+#include "Field.h"
+#include "RowSet.h"
+#include "ContainerSchema.h"
+#include "GSException.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * TQL statement with parameters ?1, ?2, ... which is parsed once and executed with bound values
+ */
+class PreparedQuery {
+    friend class Container;
+    private:
+        GSContainer *mContainer;
+        ContainerSchemaPtr mSchema;
+        GSRow* mRow;
+        const int* mCompressionList;
+
+        //Literal parts of statement, it has one more element than mParameterIndexList
+        vector<string> mSegmentList;
+        //Parameter index (from 0) placed after each literal part
+        vector<int> mParameterIndexList;
+        int mParameterCount;
+        //Buffer to build statement, it is reused for each execution
+        string mStatement;
+
+    public:
+        ~PreparedQuery();
+        void close();
+        int get_parameter_count();
+        RowSet* execute(Field* parameterList, int parameterCount, bool for_update = false);
+
+    private:
+        PreparedQuery(GSContainer *container, const ContainerSchemaPtr& schema, GSRow *gsRow,
+                const int* compressionList = NULL);
+        void parse(const char* query);
+        void append_parameter(const Field& field);
+};
+
+} /* namespace griddb */
+
+#endif /* _PREPARED_QUERY_H_ */
@@ -21,11 +21,15 @@ namespace griddb {
     /**
      * @brief Constructor a new Query::Query object
      * @param *query A pointer holding the information about a query related to a specific GSContainer
-     * @param *containerInfo A pointer holding the information about a specific GSContainer
+     * @param schema Schema of the container, it is shared with RowSet objects created by this query
      * @param *gsRow A pointer holding the information about a row related to a specific GSContainer
+     * @param *compressionList Client side compression type of each column, NULL means no compression
+     * @param *queryString TQL statement of the query
      */
-    Query::Query(GSQuery *query, GSContainerInfo *containerInfo, GSRow *gsRow) : mQuery(query),
-            mContainerInfo(containerInfo), mRow(gsRow) {
+    Query::Query(GSQuery *query, const ContainerSchemaPtr& schema, GSRow *gsRow,
+            const int* compressionList, const char* queryString) : mQuery(query),
+            mSchema(schema), mRow(gsRow), mCompressionList(compressionList), mFetchLimit(-1), mPartial(false),
+            mQueryString(queryString != NULL ? queryString : "") {
     }
 
     Query::~Query() {
@@ -59,7 +63,7 @@ namespace griddb {
         }
 
         try {
-            RowSet* rowset = new RowSet(gsRowSet, mContainerInfo, mRow);
+            RowSet* rowset = new RowSet(gsRowSet, mSchema, mRow, mCompressionList);
             return rowset;
         } catch (bad_alloc& ba) {
             gsCloseRowSet(&gsRowSet);
@@ -81,7 +85,7 @@ namespace griddb {
         }
 
         try {
-            RowSet* rowset = new RowSet(gsRowSet, mContainerInfo, mRow);
+            RowSet* rowset = new RowSet(gsRowSet, mSchema, mRow, mCompressionList);
             return rowset;
         } catch (bad_alloc& ba) {
             gsCloseRowSet(&gsRowSet);
@@ -89,6 +93,18 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Estimate the size of query result from fetch limit and schema
+     * @return Estimated size in bytes, -1 if fetch limit is not set
+     */
+    int64_t Query::get_estimated_result_size() {
+        if (mFetchLimit < 0 || !mSchema) {
+            return -1;
+        }
+        return (int64_t) mFetchLimit * (int64_t) RequestSplitter::estimate_row_size(
+                mSchema->get_type_list(), mSchema->get_column_count());
+    }
+
     /**
      * @brief Get raw pointer of GSQuery
      * @return A pointer store raw pointer of GSQuery
@@ -108,12 +124,14 @@ namespace griddb {
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mQuery, ret);
         }
+        mFetchLimit = limit;
 #if GS_COMPATIBILITY_SUPPORT_4_0
         //Need to call gsSetFetchOption as many as the number of options
         ret = gsSetFetchOption(mQuery, GS_FETCH_PARTIAL_EXECUTION, &partial, GS_TYPE_BOOL);
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mQuery, ret);
         }
+        mPartial = partial;
 #endif
     }
 }
@@ -18,9 +18,12 @@
 #define _QUERY_H_
 
 #include <memory>
+#include <string>
 
 #include "gridstore.h"
 #include "RowSet.h"
+#include "ContainerSchema.h"
+#include "RequestSplitter.h"
 #include "GSException.h"
 using namespace std;
 
@@ -32,10 +35,17 @@ namespace griddb {
 
 class Query {
     friend class Container;
+    friend class Store;
     private:
         GSQuery *mQuery;
-        GSContainerInfo *mContainerInfo;
+        ContainerSchemaPtr mSchema;
         GSRow* mRow;
+        const int* mCompressionList;
+        //Fetch limit set by set_fetch_options, -1 if not set
+        int mFetchLimit;
+        bool mPartial;
+        //TQL statement, used to execute the same query by internal connection of Store
+        string mQueryString;
 
     public:
         ~Query();
@@ -43,10 +53,12 @@ class Query {
         RowSet* fetch(bool for_update = false);
         void set_fetch_options(int limit = -1, bool partial = false);
         RowSet* get_row_set();
+        int64_t get_estimated_result_size();
         GSQuery* gs_ptr();
 
     private:
-        Query(GSQuery *query, GSContainerInfo *containerInfo, GSRow *gsRow);
+        Query(GSQuery *query, const ContainerSchemaPtr& schema, GSRow *gsRow,
+                const int* compressionList = NULL, const char* queryString = NULL);
 
 };
 
@@ -0,0 +1,205 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include "RequestSplitter.h"
+
+#include <string.h>
+
+namespace griddb {
+
+    /**
+     * @brief Estimate the size of a row from its actual field values
+     * @param *row A pointer stores row data
+     * @return Estimated size in bytes
+     */
+    size_t RequestSplitter::estimate_row_size(GSRow* row) {
+        size_t size = ROW_HEADER_SIZE_ESTIMATE;
+        GSContainerInfo info = GS_CONTAINER_INFO_INITIALIZER;
+        if (row == NULL || !GS_SUCCEEDED(gsGetRowSchema(row, &info))) {
+            return size;
+        }
+        //Schema information of row may be invalidated by following field access
+        int32_t columnCount = (int32_t) info.columnCount;
+        for (int32_t i = 0; i < columnCount; i++) {
+            GSValue value;
+            GSType type;
+            if (GS_SUCCEEDED(gsGetRowFieldGeneral(row, i, &value, &type))) {
+                size += get_field_size(type, value);
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Estimate the size of a row from column types only
+     * @param *typeList Type of each column
+     * @param columnCount Number of columns
+     * @return Estimated size in bytes, variable length fields are counted as VARIABLE_FIELD_SIZE_ESTIMATE
+     */
+    size_t RequestSplitter::estimate_row_size(const GSType* typeList, int columnCount) {
+        size_t size = ROW_HEADER_SIZE_ESTIMATE;
+        for (int i = 0; i < columnCount; i++) {
+            size_t fieldSize = get_fixed_field_size(typeList[i]);
+            if (fieldSize == 0) {
+                fieldSize = VARIABLE_FIELD_HEADER_SIZE_ESTIMATE + VARIABLE_FIELD_SIZE_ESTIMATE;
+            }
+            size += fieldSize;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Split row entries of multiple containers into chunks whose estimated size is within a limit
+     * @param *entryList Row entries of containers
+     * @param entryCount Number of entries
+     * @param sizeLimit Upper limit of estimated size of one chunk, 0 or less means no limit
+     * @param *chunkList Entries of each chunk, rows of one container may be split into consecutive
+     * ranges of adjacent chunks. A row larger than the limit is put in a chunk alone.
+     */
+    void RequestSplitter::split_row_entries(const GSContainerRowEntry* entryList, size_t entryCount,
+            int64_t sizeLimit, vector<vector<GSContainerRowEntry> >* chunkList) {
+        chunkList->assign(1, vector<GSContainerRowEntry>());
+        if (entryCount == 0) {
+            return;
+        }
+
+        //Rows of a container usually have similar size, so whether to split is decided
+        //by the first row of each container with enough margin before estimating all rows
+        double sampledSize = 0;
+        if (sizeLimit > 0) {
+            for (size_t i = 0; i < entryCount; i++) {
+                if (entryList[i].rowCount > 0 && entryList[i].rowList != NULL) {
+                    sampledSize += (double) entryList[i].rowCount *
+                            estimate_row_size((GSRow*) entryList[i].rowList[0]);
+                }
+            }
+        }
+        if (sizeLimit <= 0 || sampledSize * 2 <= (double) sizeLimit) {
+            chunkList->back().assign(entryList, entryList + entryCount);
+            return;
+        }
+
+        size_t chunkSize = 0;
+        for (size_t i = 0; i < entryCount; i++) {
+            const GSContainerRowEntry& entry = entryList[i];
+            size_t start = 0;
+            for (size_t j = 0; j < entry.rowCount; j++) {
+                size_t rowSize = estimate_row_size((GSRow*) entry.rowList[j]);
+                if (chunkSize > 0 && chunkSize + rowSize > (size_t) sizeLimit) {
+                    if (j > start) {
+                        GSContainerRowEntry subEntry = entry;
+                        subEntry.rowList = entry.rowList + start;
+                        subEntry.rowCount = j - start;
+                        chunkList->back().push_back(subEntry);
+                    }
+                    chunkList->push_back(vector<GSContainerRowEntry>());
+                    chunkSize = 0;
+                    start = j;
+                }
+                chunkSize += rowSize;
+            }
+            if (entry.rowCount == 0 || entry.rowCount > start) {
+                GSContainerRowEntry subEntry = entry;
+                subEntry.rowList = (entry.rowList == NULL) ? NULL : entry.rowList + start;
+                subEntry.rowCount = entry.rowCount - start;
+                chunkList->back().push_back(subEntry);
+            }
+        }
+    }
+
+    /**
+     * Size of a fixed length field, 0 for variable length types
+     */
+    size_t RequestSplitter::get_fixed_field_size(GSType type) {
+        switch (type) {
+        case GS_TYPE_BOOL:
+        case GS_TYPE_BYTE:
+            return 1;
+        case GS_TYPE_SHORT:
+            return 2;
+        case GS_TYPE_INTEGER:
+        case GS_TYPE_FLOAT:
+            return 4;
+        case GS_TYPE_LONG:
+        case GS_TYPE_DOUBLE:
+        case GS_TYPE_TIMESTAMP:
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Size of a field value, element size of array types is the same as fixed length field
+     */
+    size_t RequestSplitter::get_field_size(GSType type, const GSValue& value) {
+        size_t size = get_fixed_field_size(type);
+        if (size > 0) {
+            return size;
+        }
+        size = VARIABLE_FIELD_HEADER_SIZE_ESTIMATE;
+        switch (type) {
+        case GS_TYPE_STRING:
+        case GS_TYPE_GEOMETRY:
+            if (value.asString != NULL) {
+                size += strlen(value.asString);
+            }
+            break;
+        case GS_TYPE_BLOB:
+            size += value.asBlob.size;
+            break;
+        case GS_TYPE_STRING_ARRAY:
+            for (size_t i = 0; i < value.asArray.length; i++) {
+                size += VARIABLE_FIELD_HEADER_SIZE_ESTIMATE;
+                if (value.asArray.elements.asString[i] != NULL) {
+                    size += strlen(value.asArray.elements.asString[i]);
+                }
+            }
+            break;
+        case GS_TYPE_BOOL_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_BOOL);
+            break;
+        case GS_TYPE_BYTE_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_BYTE);
+            break;
+        case GS_TYPE_SHORT_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_SHORT);
+            break;
+        case GS_TYPE_INTEGER_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_INTEGER);
+            break;
+        case GS_TYPE_LONG_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_LONG);
+            break;
+        case GS_TYPE_FLOAT_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_FLOAT);
+            break;
+        case GS_TYPE_DOUBLE_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_DOUBLE);
+            break;
+        case GS_TYPE_TIMESTAMP_ARRAY:
+            size += value.asArray.length * get_fixed_field_size(GS_TYPE_TIMESTAMP);
+            break;
+        default:
+            //Null field
+            size = 0;
+            break;
+        }
+        return size;
+    }
+
+} /* namespace griddb */
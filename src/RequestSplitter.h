@@ -0,0 +1,58 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#ifndef _REQUEST_SPLITTER_H_
+#define _REQUEST_SPLITTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include <new>
+
+#include "gridstore.h"
+
+//Default upper limit of estimated size of one multi-container request, 0 disables splitting
+#define DEFAULT_REQUEST_SIZE_LIMIT (16 * 1024 * 1024)
+//Estimated overhead of one row and of one variable length field
+#define ROW_HEADER_SIZE_ESTIMATE 8
+#define VARIABLE_FIELD_HEADER_SIZE_ESTIMATE 4
+//Estimated data size of one variable length field when its value is unknown
+#define VARIABLE_FIELD_SIZE_ESTIMATE 64
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Estimate the size of rows sent to or received from the server
+ * and split multi-container row entries into requests within a size limit.
+ */
+class RequestSplitter {
+    public:
+        static size_t estimate_row_size(GSRow* row);
+        static size_t estimate_row_size(const GSType* typeList, int columnCount);
+        static void split_row_entries(const GSContainerRowEntry* entryList, size_t entryCount,
+                int64_t sizeLimit, vector<vector<GSContainerRowEntry> >* chunkList);
+
+    private:
+        static size_t get_fixed_field_size(GSType type);
+        static size_t get_field_size(GSType type, const GSValue& value);
+};
+
+} /* namespace griddb */
+
+#endif /* _REQUEST_SPLITTER_H_ */
@@ -0,0 +1,290 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "RowBatch.h"
+
+#include <limits>
+
+namespace griddb {
+
+    /**
+     * @brief Constructor a new RowBatch::RowBatch object
+     * @param columnCount Number of column in row
+     * @param *typeList List type of column in row
+     */
+    RowBatch::RowBatch(int columnCount, const GSType* typeList) :
+            mColumnCount(columnCount), mTypeList(NULL), mRowCount(0) {
+        for (int i = 0; i < columnCount; i++) {
+            if (!is_supported_type(typeList[i])) {
+                throw GSException("Column type is not supported for columnar fetch");
+            }
+        }
+        try {
+            mTypeList = new GSType[columnCount]();
+            mNumberList.resize(columnCount);
+            mHeapList.resize(columnCount);
+            mOffsetList.resize(columnCount);
+            mNullList.resize(columnCount);
+        } catch (bad_alloc& ba) {
+            if (mTypeList) {
+                delete[] mTypeList;
+            }
+            throw GSException("Memory allocation error");
+        }
+        for (int i = 0; i < columnCount; i++) {
+            mTypeList[i] = typeList[i];
+            if (!is_number_type(typeList[i])) {
+                mOffsetList[i].push_back(0);
+            }
+        }
+    }
+
+    RowBatch::~RowBatch() {
+        if (mTypeList) {
+            delete[] mTypeList;
+        }
+    }
+
+    /**
+     * @brief Check column type is stored as double
+     * @param type Type of column
+     * @return True if column is fixed-width type
+     */
+    bool RowBatch::is_number_type(GSType type) {
+        switch (type) {
+        case GS_TYPE_BOOL:
+        case GS_TYPE_BYTE:
+        case GS_TYPE_SHORT:
+        case GS_TYPE_INTEGER:
+        case GS_TYPE_LONG:
+        case GS_TYPE_FLOAT:
+        case GS_TYPE_DOUBLE:
+        case GS_TYPE_TIMESTAMP:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief Check column type can be stored in RowBatch
+     * @param type Type of column
+     * @return True if column type is supported, array types are not supported
+     */
+    bool RowBatch::is_supported_type(GSType type) {
+        return is_number_type(type) || type == GS_TYPE_STRING ||
+                type == GS_TYPE_GEOMETRY || type == GS_TYPE_BLOB;
+    }
+
+    /**
+     * @brief Append values of a row to column buffers
+     * @param *row A pointer stores row data
+     */
+    void RowBatch::append(GSRow* row) {
+        GSResult ret;
+        vector<char> decoded;
+        try {
+            for (int i = 0; i < mColumnCount; i++) {
+                GSBool nullValue;
+                ret = gsGetRowFieldNull(row, (int32_t) i, &nullValue);
+                if (!GS_SUCCEEDED(ret)) {
+                    throw GSException(row, ret);
+                }
+                mNullList[i].push_back(nullValue == GS_TRUE);
+
+                double number = numeric_limits<double>::quiet_NaN();
+                const GSChar* data = NULL;
+                size_t size = 0;
+                if (!nullValue) {
+                    switch (mTypeList[i]) {
+                    case GS_TYPE_BOOL: {
+                        GSBool value;
+                        ret = gsGetRowFieldAsBool(row, (int32_t) i, &value);
+                        number = value ? 1 : 0;
+                        break;
+                    }
+                    case GS_TYPE_BYTE: {
+                        int8_t value;
+                        ret = gsGetRowFieldAsByte(row, (int32_t) i, &value);
+                        number = value;
+                        break;
+                    }
+                    case GS_TYPE_SHORT: {
+                        int16_t value;
+                        ret = gsGetRowFieldAsShort(row, (int32_t) i, &value);
+                        number = value;
+                        break;
+                    }
+                    case GS_TYPE_INTEGER: {
+                        int32_t value;
+                        ret = gsGetRowFieldAsInteger(row, (int32_t) i, &value);
+                        number = value;
+                        break;
+                    }
+                    case GS_TYPE_LONG: {
+                        int64_t value;
+                        ret = gsGetRowFieldAsLong(row, (int32_t) i, &value);
+                        number = (double) value;
+                        break;
+                    }
+                    case GS_TYPE_FLOAT: {
+                        float value;
+                        ret = gsGetRowFieldAsFloat(row, (int32_t) i, &value);
+                        number = value;
+                        break;
+                    }
+                    case GS_TYPE_DOUBLE: {
+                        ret = gsGetRowFieldAsDouble(row, (int32_t) i, &number);
+                        break;
+                    }
+                    case GS_TYPE_TIMESTAMP: {
+                        GSTimestamp value;
+                        ret = gsGetRowFieldAsTimestamp(row, (int32_t) i, &value);
+                        number = (double) value;
+                        break;
+                    }
+                    case GS_TYPE_STRING:
+                        ret = gsGetRowFieldAsString(row, (int32_t) i, &data);
+                        size = (data == NULL) ? 0 : strlen(data);
+                        break;
+                    case GS_TYPE_GEOMETRY:
+                        ret = gsGetRowFieldAsGeometry(row, (int32_t) i, &data);
+                        size = (data == NULL) ? 0 : strlen(data);
+                        break;
+                    case GS_TYPE_BLOB: {
+                        GSBlob blobValue;
+                        ret = gsGetRowFieldAsBlob(row, (int32_t) i, &blobValue);
+                        data = (const GSChar*) blobValue.data;
+                        size = blobValue.size;
+                        if (GS_SUCCEEDED(ret) && BlobCodec::decode(data, size, &decoded)) {
+                            data = decoded.empty() ? NULL : &decoded[0];
+                            size = decoded.size();
+                        }
+                        break;
+                    }
+                    default:
+                        throw GSException("Column type is not supported for columnar fetch");
+                    }
+                    if (!GS_SUCCEEDED(ret)) {
+                        throw GSException(row, ret);
+                    }
+                }
+
+                if (is_number_type(mTypeList[i])) {
+                    mNumberList[i].push_back(number);
+                } else {
+                    if (size > 0) {
+                        mHeapList[i].insert(mHeapList[i].end(), data, data + size);
+                    }
+                    mOffsetList[i].push_back(mHeapList[i].size());
+                }
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException("Memory allocation error");
+        }
+        mRowCount++;
+    }
+
+    /**
+     * @brief Get number of row in batch
+     * @return Number of row
+     */
+    int32_t RowBatch::get_row_count() {
+        return mRowCount;
+    }
+
+    /**
+     * @brief Get number of column in batch
+     * @return Number of column
+     */
+    int RowBatch::get_column_count() {
+        return mColumnCount;
+    }
+
+    /**
+     * @brief Get type of column
+     * @param column Column index
+     * @return Type of column
+     */
+    GSType RowBatch::get_column_type(int column) {
+        return mTypeList[column];
+    }
+
+    /**
+     * @brief Check value is NULL
+     * @param column Column index
+     * @param rowIndex Row index in batch
+     * @return True if value is NULL
+     */
+    bool RowBatch::is_null(int column, int32_t rowIndex) {
+        return mNullList[column][rowIndex];
+    }
+
+    /**
+     * @brief Get values of fixed-width column, NULL value is NaN
+     * @param column Column index
+     * @return Array has get_row_count() elements, or NULL if column is not fixed-width type
+     */
+    const double* RowBatch::get_number_column(int column) {
+        if (!is_number_type(mTypeList[column]) || mRowCount == 0) {
+            return NULL;
+        }
+        return &mNumberList[column][0];
+    }
+
+    /**
+     * @brief Get heap of STRING, GEOMETRY or BLOB column
+     * @param column Column index
+     * @param *size Size of heap in bytes
+     * @return Heap stores all values of column continuously
+     */
+    const GSChar* RowBatch::get_heap(int column, size_t* size) {
+        *size = mHeapList[column].size();
+        if (*size == 0) {
+            return NULL;
+        }
+        return &mHeapList[column][0];
+    }
+
+    /**
+     * @brief Get start offset of each value in heap of column
+     * @param column Column index
+     * @return Array has get_row_count() + 1 elements, or NULL if column is fixed-width type
+     */
+    const size_t* RowBatch::get_offset_list(int column) {
+        if (is_number_type(mTypeList[column])) {
+            return NULL;
+        }
+        return &mOffsetList[column][0];
+    }
+
+    /**
+     * @brief Get value of STRING, GEOMETRY or BLOB column
+     * @param column Column index
+     * @param rowIndex Row index in batch
+     * @param *size Size of value in bytes
+     * @return Pointer to value in heap, it is not null-terminated
+     */
+    const GSChar* RowBatch::get_value(int column, int32_t rowIndex, size_t* size) {
+        size_t start = mOffsetList[column][rowIndex];
+        *size = mOffsetList[column][rowIndex + 1] - start;
+        if (*size == 0) {
+            return "";
+        }
+        return &mHeapList[column][start];
+    }
+
+} /* namespace griddb */
@@ -0,0 +1,65 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _ROW_BATCH_H_
+#define _ROW_BATCH_H_
+
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+
+#include "gridstore.h"
+#include "GSException.h"
+#include "BlobCodec.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Column oriented buffer of Rows fetched from a RowSet.
+ * Fixed-width columns are stored as double (NaN means NULL),
+ * STRING, GEOMETRY and BLOB columns are stored in one heap per column with offsets.
+ */
+class RowBatch {
+    int mColumnCount;
+    GSType* mTypeList;
+    int32_t mRowCount;
+    vector< vector<double> > mNumberList;
+    vector< vector<GSChar> > mHeapList;
+    vector< vector<size_t> > mOffsetList;
+    vector< vector<bool> > mNullList;
+
+    public:
+        RowBatch(int columnCount, const GSType* typeList);
+        ~RowBatch();
+        void append(GSRow* row);
+        int32_t get_row_count();
+        int get_column_count();
+        GSType get_column_type(int column);
+        bool is_null(int column, int32_t rowIndex);
+        const double* get_number_column(int column);
+        const GSChar* get_heap(int column, size_t* size);
+        const size_t* get_offset_list(int column);
+        const GSChar* get_value(int column, int32_t rowIndex, size_t* size);
+
+        static bool is_number_type(GSType type);
+        static bool is_supported_type(GSType type);
+};
+
+} /* namespace griddb */
+
+#endif /* _ROW_BATCH_H_ */
@@ -21,12 +21,15 @@ namespace griddb {
     /**
      * @brief Constructor a new RowSet::RowSet object
      * @param *rowSet A pointer manages a set of Rows obtained by a query
-     * @param *containerInfo A pointer holding the information about a specific GSContainer
+     * @param schema Schema of the container, RowSet keeps it alive after Container is closed
      * @param *gsRow A pointer holding the information about a row related to a specific GSContainer
+     * @param *compressionList Client side compression type of each column, NULL means no compression
      */
-    RowSet::RowSet(GSRowSet *rowSet, GSContainerInfo *containerInfo, GSRow *gsRow) :
-        mRowSet(rowSet), mContainerInfo(containerInfo), mRow(gsRow),
-        timestamp_output_with_float(false), typeList(NULL) {
+    RowSet::RowSet(GSRowSet *rowSet, const ContainerSchemaPtr& schema, GSRow *gsRow,
+            const int* compressionList) :
+        mRowSet(rowSet), mSchema(schema), mContainerInfo(schema ? schema->gs_info() : NULL), mRow(gsRow),
+        timestamp_output_with_float(false), mCompressionList(compressionList),
+        mQuery(NULL), mContainer(NULL) {
         if (mRowSet != NULL) {
             mType = gsGetRowSetType(mRowSet);
         } else {
@@ -53,9 +56,6 @@ namespace griddb {
 
     RowSet::~RowSet() {
         close();
-        if (typeList) {
-            delete[] typeList;
-        }
     }
 
     /**
@@ -66,6 +66,15 @@ namespace griddb {
             gsCloseRowSet(&mRowSet);
             mRowSet = NULL;
         }
+        if (mQuery != NULL) {
+            gsCloseQuery(&mQuery);
+            mQuery = NULL;
+        }
+        if (mContainer != NULL) {
+            gsCloseRow(&mRow);
+            gsCloseContainer(&mContainer, GS_FALSE);
+            mContainer = NULL;
+        }
     }
 
     /**
@@ -73,6 +82,7 @@ namespace griddb {
      * @param *row A Row object representing the content of a Row to be put to database
      */
     void RowSet::update(GSRow* row) {
+        BlobCodec::encode_row(mRow, mCompressionList, getColumnCount());
         GSResult ret = gsUpdateCurrentRow(mRowSet, mRow);
 
         if (!GS_SUCCEEDED(ret)) {
@@ -125,6 +135,49 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Read remaining rows into column oriented buffer
+     * @param maxRowCount Max number of rows to read, 0 means all remaining rows
+     * @return A pointer stores values of rows by column, need to be freed by caller
+     */
+    RowBatch* RowSet::fetch_columns(int32_t maxRowCount) {
+        if (mType != GS_ROW_SET_CONTAINER_ROWS) {
+            throw GSException(mRowSet, "type for rowset is not correct");
+        }
+
+        RowBatch* batch;
+        try {
+            batch = new RowBatch(getColumnCount(), getGSTypeList());
+        } catch (bad_alloc& ba) {
+            throw GSException(mRowSet, "Memory allocation error");
+        }
+
+        try {
+            while ((maxRowCount <= 0 || batch->get_row_count() < maxRowCount) &&
+                    gsHasNextRow(mRowSet)) {
+                GSResult ret = gsGetNextRow(mRowSet, mRow);
+                if (!GS_SUCCEEDED(ret)) {
+                    throw GSException(mRowSet, ret);
+                }
+                batch->append(mRow);
+            }
+        } catch (GSException& e) {
+            delete batch;
+            throw;
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Read remaining rows into column oriented buffer which is copied to SharedArrayBuffer
+     * @param maxRowCount Max number of rows to read, 0 means all remaining rows
+     * @param **sharedBatch A pointer to store values of rows by column, it is freed in typemap
+     */
+    void RowSet::fetch_shared(int32_t maxRowCount, RowBatch** sharedBatch) {
+        assert(sharedBatch != NULL);
+        *sharedBatch = fetch_columns(maxRowCount);
+    }
+
     /**
      * @brief Get size of this rowset
      * @return Size of this rowset
@@ -232,19 +285,8 @@ namespace griddb {
      * @brief Get list type of column in row
      * @return A list type of column in row
      */
-    GSType* RowSet::getGSTypeList(){
-        if (typeList == NULL) {
-            try {
-                typeList = new GSType[mContainerInfo->columnCount]();
-            } catch (bad_alloc& ba) {
-                throw GSException(mRowSet, "Memory allocation error");
-            }
-            
-            for (int i = 0; i < mContainerInfo->columnCount; i++){
-                typeList[i] = mContainerInfo->columnInfoList[i].type;
-            }
-        }
-        return typeList;
+    const GSType* RowSet::getGSTypeList(){
+        return mSchema->get_type_list();
     }
 
     /**
@@ -255,6 +297,14 @@ namespace griddb {
         return mContainerInfo->columnCount;
     }
 
+    /**
+     * @brief Get information of columns in row
+     * @return A list stores name and type of each column
+     */
+    GSColumnInfo* RowSet::getColumnInfoList(){
+        return (GSColumnInfo*) mContainerInfo->columnInfoList;
+    }
+
     /**
      * @brief Get row data in RowSet object
      * @return A pointer stores row data in RowSet object
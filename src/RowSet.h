@@ -25,6 +25,9 @@
 
 #include "gridstore.h"
 #include "Field.h"
+#include "RowBatch.h"
+#include "ContainerSchema.h"
+#include "BlobCodec.h"
 #include "AggregationResult.h"
 #include "QueryAnalysisEntry.h"
 #include "GSException.h"
@@ -39,11 +42,19 @@ namespace griddb {
  */
 class RowSet {
     GSRowSet *mRowSet;
-    GSContainerInfo *mContainerInfo;
+    //Schema shared with Container, mContainerInfo refers to it
+    ContainerSchemaPtr mSchema;
+    const GSContainerInfo *mContainerInfo;
     GSRow *mRow;
-    GSType* typeList;
+    const int* mCompressionList;
+    //Query owned by RowSet, it is set when RowSet is created by PreparedQuery
+    GSQuery *mQuery;
+    //Container owned by RowSet with mQuery and mRow, it is set when RowSet is fetched by internal connection of Store
+    GSContainer *mContainer;
 
     friend class Query;
+    friend class PreparedQuery;
+    friend class Store;
 
     GSRowSetType mType;
 
@@ -63,13 +74,17 @@ class RowSet {
         QueryAnalysisEntry* get_next_query_analysis();
         AggregationResult* get_next_aggregation();
         void next_row(bool* hasNextRow);
-        GSType* getGSTypeList();
+        RowBatch* fetch_columns(int32_t maxRowCount = 0);
+        void fetch_shared(int32_t maxRowCount, RowBatch** sharedBatch);
+        const GSType* getGSTypeList();
         int getColumnCount();
+        GSColumnInfo* getColumnInfoList();
 
         GSRow* getGSRowPtr();
 
     private:
-        RowSet(GSRowSet *rowSet, GSContainerInfo *containerInfo, GSRow *mRow);
+        RowSet(GSRowSet *rowSet, const ContainerSchemaPtr& schema, GSRow *mRow,
+                const int* compressionList = NULL);
 };
 
 }
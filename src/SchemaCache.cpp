@@ -0,0 +1,130 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "SchemaCache.h"
+
+#include <chrono>
+
+namespace griddb {
+
+    SchemaCache::SchemaCache() : mTtl(0) {
+    }
+
+    SchemaCache::~SchemaCache() {
+        clear();
+    }
+
+    /**
+     * @brief Set time to live of cache entries
+     * @param ttl Time to live in milliseconds, 0 disables cache and removes all entries
+     */
+    void SchemaCache::set_ttl(int64_t ttl) {
+        if (ttl < 0) {
+            throw GSException("TTL of schema cache must not be negative");
+        }
+        mTtl = ttl;
+        if (mTtl == 0) {
+            clear();
+        }
+    }
+
+    /**
+     * @brief Get time to live of cache entries
+     * @return Time to live in milliseconds
+     */
+    int64_t SchemaCache::get_ttl() {
+        return mTtl;
+    }
+
+    /**
+     * @brief Check cache is enabled
+     * @return True if TTL is greater than 0
+     */
+    bool SchemaCache::enabled() {
+        return mTtl > 0;
+    }
+
+    /**
+     * @brief Get cached container schema
+     * @param *name Container name
+     * @return Shared schema which stays valid after the entry is invalidated, empty if not cached or expired
+     */
+    ContainerSchemaPtr SchemaCache::get(const GSChar* name) {
+        if (!enabled() || name == NULL || mEntryMap.empty()) {
+            return ContainerSchemaPtr();
+        }
+        map<string, Entry>::iterator it = mEntryMap.find(Util::to_lower(name));
+        if (it == mEntryMap.end()) {
+            return ContainerSchemaPtr();
+        }
+        if (it->second.expireTime <= now()) {
+            mEntryMap.erase(it);
+            return ContainerSchemaPtr();
+        }
+        return it->second.schema;
+    }
+
+    /**
+     * @brief Store container schema, it is shared with objects which already use it
+     * @param *name Container name
+     * @param schema Container schema got from server
+     */
+    void SchemaCache::put(const GSChar* name, const ContainerSchemaPtr& schema) {
+        if (!enabled() || name == NULL || !schema) {
+            return;
+        }
+        invalidate(name);
+        //Cache is optional, container information is got from server next time if it fails
+        Entry entry;
+        entry.schema = schema;
+        entry.expireTime = now() + mTtl;
+        try {
+            mEntryMap[Util::to_lower(name)] = entry;
+        } catch (bad_alloc& ba) {
+        }
+    }
+
+    /**
+     * @brief Remove cached container information
+     * @param *name Container name
+     */
+    void SchemaCache::invalidate(const GSChar* name) {
+        if (name == NULL || mEntryMap.empty()) {
+            return;
+        }
+        map<string, Entry>::iterator it = mEntryMap.find(Util::to_lower(name));
+        if (it != mEntryMap.end()) {
+            mEntryMap.erase(it);
+        }
+    }
+
+    /**
+     * @brief Remove all cached container information
+     */
+    void SchemaCache::clear() {
+        mEntryMap.clear();
+    }
+
+    /**
+     * @brief Get current time of monotonic clock
+     * @return Current time in milliseconds
+     */
+    int64_t SchemaCache::now() {
+        return chrono::duration_cast<chrono::milliseconds>(
+                chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+} /* namespace griddb */
@@ -0,0 +1,61 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _SCHEMA_CACHE_H_
+#define _SCHEMA_CACHE_H_
+
+#include <map>
+#include <string>
+#include <stdint.h>
+
+#include "gridstore.h"
+#include "ContainerSchema.h"
+#include "GSException.h"
+#include "Util.h"
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Cache of container schema per Store, key is lowercase container name.
+ * Entries expire after TTL, cache is disabled when TTL is 0.
+ */
+class SchemaCache {
+    struct Entry {
+        ContainerSchemaPtr schema;
+        int64_t expireTime;
+    };
+    map<string, Entry> mEntryMap;
+    int64_t mTtl;
+
+    public:
+        SchemaCache();
+        ~SchemaCache();
+        void set_ttl(int64_t ttl);
+        int64_t get_ttl();
+        bool enabled();
+        ContainerSchemaPtr get(const GSChar* name);
+        void put(const GSChar* name, const ContainerSchemaPtr& schema);
+        void invalidate(const GSChar* name);
+        void clear();
+
+        static int64_t now();
+};
+
+} /* namespace griddb */
+
+#endif /* _SCHEMA_CACHE_H_ */
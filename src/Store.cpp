@@ -16,13 +16,17 @@
 
 #include "Store.h"
 
+#include <thread>
+#include <atomic>
+
 namespace griddb {
 
     /**
      * @brief Constructor a new Store::Store object
      * @param *store A pointer which provides functions to manipulate the entire data managed in one GridDB system.
      */
-    Store::Store(GSGridStore *store) : mStore(store), timestamp_output_with_float(false) {
+    Store::Store(GSGridStore *store) : mStore(store), mFactory(NULL), mPartitionController(NULL),
+            mRequestSizeLimit(DEFAULT_REQUEST_SIZE_LIMIT), timestamp_output_with_float(false) {
     }
 
     Store::~Store() {
@@ -34,6 +38,11 @@ namespace griddb {
      * @brief Release Store resource
      */
     void Store::close(GSBool allRelated) {
+        close_worker_store_list();
+        if (mPartitionController != NULL) {
+            delete mPartitionController;
+            mPartitionController = NULL;
+        }
         // close store
         if (mStore != NULL) {
             gsCloseGridStore(&mStore, allRelated);
@@ -50,6 +59,10 @@ namespace griddb {
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mStore, ret);
         }
+        mSchemaCache.invalidate(name);
+        if (name != NULL) {
+            mCompressionMap.erase(Util::to_lower(name));
+        }
     }
 
     /**
@@ -58,22 +71,33 @@ namespace griddb {
      * @return Return a pointer which stores all information of container
      */
     ContainerInfo* Store::get_container_info(const char* name) {
-        GSContainerInfo gsContainerInfo = GS_CONTAINER_INFO_INITIALIZER;
-        GSChar bExists;
-        GSResult ret = gsGetContainerInfo(mStore, name, &gsContainerInfo, &bExists);
-        if (!GS_SUCCEEDED(ret)) {
-            throw GSException(mStore, ret);
-        }
-        if (bExists == false) {
+        ContainerSchemaPtr schema = find_container_schema(name);
+        if (!schema) {
             return NULL;
         }
+        const GSContainerInfo* gsContainerInfo = schema->gs_info();
 
+        ContainerInfo* containerInfo;
         try {
-            ContainerInfo* containerInfo = new ContainerInfo(&gsContainerInfo);
-            return containerInfo;
+            containerInfo = new ContainerInfo(schema);
         } catch (bad_alloc& ba) {
             throw GSException(mStore, "Memory allocation error");
         }
+
+        const int* compressionList = get_compression_list(name);
+        if (compressionList != NULL) {
+            try {
+                for (int i = 0; i < (int) gsContainerInfo->columnCount; i++) {
+                    if (gsContainerInfo->columnInfoList[i].type == GS_TYPE_BLOB) {
+                        containerInfo->set_column_compression(i, compressionList[i]);
+                    }
+                }
+            } catch (GSException& e) {
+                delete containerInfo;
+                throw;
+            }
+        }
+        return containerInfo;
     }
 
     /**
@@ -92,17 +116,46 @@ namespace griddb {
         GSContainer* pContainer = NULL;
         // Create new gsContainer
         GSResult ret = gsPutContainerGeneral(mStore, gsInfo->name, gsInfo, modifiable, &pContainer);
+        //Schema may be changed
+        mSchemaCache.invalidate(gsInfo->name);
         if (!GS_SUCCEEDED(ret)) {
             throw GSException(mStore, ret);
         }
 
+        ContainerSchemaPtr schema;
+        try {
+            schema = info->get_schema();
+        } catch (GSException& e) {
+            gsCloseContainer(&pContainer, GS_FALSE);
+            throw;
+        }
+
+        Container* container;
         try {
-            Container* container = new Container(pContainer, gsInfo);
-            return container;
+            container = new Container(pContainer, schema, mStore);
         } catch (bad_alloc& ba) {
             gsCloseContainer(&pContainer, GS_FALSE);
             throw GSException(mStore, "Memory allocation error");
         }
+
+        //Remember compression setting so that containers got later by name use it too
+        const int* compressionList = info->get_compression_list();
+        try {
+            string key = Util::to_lower(gsInfo->name);
+            if (compressionList != NULL) {
+                mCompressionMap[key].assign(compressionList, compressionList + gsInfo->columnCount);
+            } else {
+                mCompressionMap.erase(key);
+            }
+            container->set_compression_list(compressionList);
+        } catch (bad_alloc& ba) {
+            delete container;
+            throw GSException(mStore, "Memory allocation error");
+        } catch (GSException& e) {
+            delete container;
+            throw;
+        }
+        return container;
     }
 
     /**
@@ -118,22 +171,76 @@ namespace griddb {
         }
         if (pContainer == NULL) {
             //If not found container, return NULL in target language
+            mSchemaCache.invalidate(name);
             return NULL;
         }
-        GSContainerInfo containerInfo = GS_CONTAINER_INFO_INITIALIZER;
-        GSChar bExists;
-        ret = gsGetContainerInfo(mStore, name, &containerInfo, &bExists);
-        if (!GS_SUCCEEDED(ret)) {
+        ContainerSchemaPtr schema;
+        try {
+            schema = find_container_schema(name);
+        } catch (GSException& e) {
             gsCloseContainer(&pContainer, GS_FALSE);
-            throw GSException(mStore, ret);
+            throw;
+        }
+        if (!schema) {
+            gsCloseContainer(&pContainer, GS_FALSE);
+            return NULL;
         }
+        Container* container;
         try {
-            Container* container = new Container(pContainer, &containerInfo);
-            return container;
+            container = new Container(pContainer, schema, mStore);
         } catch (bad_alloc& ba) {
             gsCloseContainer(&pContainer, GS_FALSE);
             throw GSException(mStore, "Memory allocation error");
         }
+        try {
+            container->set_compression_list(get_compression_list(name));
+        } catch (GSException& e) {
+            delete container;
+            throw;
+        }
+        return container;
+    }
+
+    /**
+     * @brief Reload schema of a container from server, the container is reopened if schema was changed
+     * @param *container Container got from this Store
+     * @param force Reopen the container even if schema is not changed, it is used after the container was dropped or put
+     * @return True if the container was reopened
+     */
+    bool Store::refresh_container(Container* container, bool force) {
+        if (container == NULL || container->mContainer == NULL) {
+            throw GSException(mStore, "Container is null or closed");
+        }
+        string name = container->mContainerInfo->name ? container->mContainerInfo->name : "";
+        mSchemaCache.invalidate(name.c_str());
+        ContainerSchemaPtr schema = find_container_schema(name.c_str());
+        if (!schema) {
+            throw GSException(mStore, "Container does not exist");
+        }
+        if (!force && schema->has_same_columns(*container->mSchema)) {
+            return false;
+        }
+
+        GSContainer* pContainer;
+        GSResult ret = gsGetContainerGeneral(mStore, name.c_str(), &pContainer);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mStore, ret);
+        }
+        if (pContainer == NULL) {
+            throw GSException(mStore, "Container does not exist");
+        }
+        int columnCount = container->getColumnCount();
+        try {
+            container->reset(pContainer, schema);
+        } catch (GSException& e) {
+            gsCloseContainer(&pContainer, GS_FALSE);
+            throw;
+        }
+        //Compression setting for old columns can not be applied to new layout
+        if (schema->get_column_count() != columnCount) {
+            mCompressionMap.erase(Util::to_lower(name.c_str()));
+        }
+        return true;
     }
 
     /**
@@ -148,6 +255,191 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Execute groups of queries concurrently by internal connections, each group is requested by one gsFetchAll.
+     * Each query is created again from its TQL statement and fetch options on the connection,
+     * so it is not executed in the transaction of its container.
+     * @param **queryList Queries of all groups, queries of a group are consecutive
+     * @param *groupSizeList Number of queries of each group
+     * @param groupCount Number of groups
+     * @param parallelism Number of connections used concurrently
+     * @param *groupOrderList Index of groups in the order of completion
+     * @param *rowSetList RowSet of each query, it owns the container and query opened by the internal connection
+     */
+    void Store::fetch_all_by_group(Query* const* queryList, const size_t* groupSizeList, size_t groupCount,
+            int parallelism, std::vector<int>* groupOrderList, std::vector<RowSet*>* rowSetList) {
+        assert(groupOrderList != NULL);
+        assert(rowSetList != NULL);
+        if (parallelism < 1) {
+            throw GSException(mStore, "Parallelism must be greater than 0");
+        }
+        vector<size_t> groupStartList;
+        try {
+            size_t queryCount = 0;
+            groupStartList.reserve(groupCount);
+            for (size_t i = 0; i < groupCount; i++) {
+                groupStartList.push_back(queryCount);
+                queryCount += groupSizeList[i];
+            }
+            rowSetList->assign(queryCount, NULL);
+            groupOrderList->assign(groupCount, -1);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        if (groupCount == 0) {
+            return;
+        }
+
+        int workerCount = parallelism;
+        if (workerCount > MAX_WORKER_STORE_COUNT) {
+            workerCount = MAX_WORKER_STORE_COUNT;
+        }
+        if (workerCount > (int) groupCount) {
+            workerCount = (int) groupCount;
+        }
+        vector<string> workerErrorList;
+        vector<thread> threadList;
+        try {
+            open_worker_store_list(workerCount);
+            workerErrorList.resize(workerCount);
+            threadList.reserve(workerCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        atomic<int> nextGroup(0);
+        atomic<int> completedCount(0);
+        atomic<bool> failed(false);
+        atomic<bool> memoryError(false);
+        auto worker = [&](int index) {
+            GSGridStore* store = mWorkerStoreList[index];
+            vector<GSContainer*> containerList;
+            vector<GSQuery*> gsQueryList;
+            vector<GSRow*> rowList;
+            while (!failed) {
+                int group = nextGroup++;
+                if (group >= (int) groupCount) {
+                    return;
+                }
+                size_t start = groupStartList[group];
+                size_t count = groupSizeList[group];
+                GSResult ret = GS_RESULT_OK;
+                try {
+                    containerList.assign(count, NULL);
+                    gsQueryList.assign(count, NULL);
+                    rowList.assign(count, NULL);
+                    for (size_t i = 0; i < count && GS_SUCCEEDED(ret); i++) {
+                        Query* query = queryList[start + i];
+                        ret = gsGetContainerGeneral(store, query->mSchema->gs_info()->name, &containerList[i]);
+                        if (!GS_SUCCEEDED(ret)) {
+                            workerErrorList[index] = GSException(store, ret).what();
+                            break;
+                        }
+                        if (containerList[i] == NULL) {
+                            workerErrorList[index] = "Container does not exist";
+                            ret = -1;
+                            break;
+                        }
+                        ret = gsQuery(containerList[i], query->mQueryString.c_str(), &gsQueryList[i]);
+                        if (GS_SUCCEEDED(ret) && query->mFetchLimit >= 0) {
+                            int limit = query->mFetchLimit;
+                            ret = gsSetFetchOption(gsQueryList[i], GS_FETCH_LIMIT, &limit, GS_TYPE_INTEGER);
+                        }
+#if GS_COMPATIBILITY_SUPPORT_4_0
+                        if (GS_SUCCEEDED(ret) && query->mPartial) {
+                            GSBool partial = GS_TRUE;
+                            ret = gsSetFetchOption(gsQueryList[i], GS_FETCH_PARTIAL_EXECUTION, &partial, GS_TYPE_BOOL);
+                        }
+#endif
+                        if (GS_SUCCEEDED(ret)) {
+                            ret = gsCreateRowByContainer(containerList[i], &rowList[i]);
+                        }
+                        if (!GS_SUCCEEDED(ret)) {
+                            //Error information of a container is valid until next call for it
+                            workerErrorList[index] = GSException(containerList[i], ret).what();
+                        }
+                    }
+                    if (GS_SUCCEEDED(ret) && count > 0) {
+                        ret = gsFetchAll(store, &gsQueryList[0], count);
+                        if (!GS_SUCCEEDED(ret)) {
+                            workerErrorList[index] = GSException(store, ret).what();
+                        }
+                    }
+                    for (size_t i = 0; i < count && GS_SUCCEEDED(ret); i++) {
+                        Query* query = queryList[start + i];
+                        GSRowSet* gsRowSet;
+                        ret = gsGetRowSet(gsQueryList[i], &gsRowSet);
+                        if (!GS_SUCCEEDED(ret)) {
+                            workerErrorList[index] = GSException(gsQueryList[i], ret).what();
+                            break;
+                        }
+                        RowSet* rowSet;
+                        try {
+                            rowSet = new RowSet(gsRowSet, query->mSchema, rowList[i], query->mCompressionList);
+                        } catch (bad_alloc& ba) {
+                            gsCloseRowSet(&gsRowSet);
+                            throw;
+                        }
+                        //Resources are closed with RowSet
+                        rowSet->mQuery = gsQueryList[i];
+                        rowSet->mContainer = containerList[i];
+                        (*rowSetList)[start + i] = rowSet;
+                        gsQueryList[i] = NULL;
+                        containerList[i] = NULL;
+                        rowList[i] = NULL;
+                    }
+                } catch (bad_alloc& ba) {
+                    memoryError = true;
+                    ret = -1;
+                }
+                for (size_t i = 0; i < containerList.size(); i++) {
+                    if (gsQueryList[i] != NULL) {
+                        gsCloseQuery(&gsQueryList[i]);
+                    }
+                    if (rowList[i] != NULL) {
+                        gsCloseRow(&rowList[i]);
+                    }
+                    if (containerList[i] != NULL) {
+                        gsCloseContainer(&containerList[i], GS_FALSE);
+                    }
+                }
+                if (!GS_SUCCEEDED(ret)) {
+                    failed = true;
+                    return;
+                }
+                (*groupOrderList)[completedCount++] = group;
+            }
+        };
+        for (int i = 1; i < workerCount; i++) {
+            try {
+                threadList.push_back(thread(worker, i));
+            } catch (...) {
+                //Remaining groups are processed by started threads and current thread
+                break;
+            }
+        }
+        worker(0);
+        for (size_t i = 0; i < threadList.size(); i++) {
+            threadList[i].join();
+        }
+
+        if (failed) {
+            for (size_t i = 0; i < rowSetList->size(); i++) {
+                delete (*rowSetList)[i];
+            }
+            rowSetList->clear();
+            groupOrderList->clear();
+            if (memoryError) {
+                throw GSException(mStore, "Memory allocation error");
+            }
+            for (int i = 0; i < workerCount; i++) {
+                if (!workerErrorList[i].empty()) {
+                    throw GSException(mStore, workerErrorList[i].c_str());
+                }
+            }
+        }
+    }
+
     /**
      * @brief Get Partition controller.
      * @return The pointer to a pointer variable to store PartitionController instance
@@ -195,6 +487,7 @@ namespace griddb {
 
     /**
      * @brief New creation or update operation is carried out on an arbitrary number of rows of multiple Containers, with the request unit enlarged as much as possible.
+     * Rows are put by multiple requests if their estimated size exceeds the request size limit.
      * @param ***listRow A pointer refers list of row data
      * @param *listRowContainerCount A array store number of list row for each container
      * @param **listContainerName list container name
@@ -204,23 +497,469 @@ namespace griddb {
             const char ** listContainerName, size_t containerCount) {
         assert(listRowContainerCount != NULL);
         assert(listContainerName != NULL);
-        GSResult ret;
-        GSContainerRowEntry* entryList;
-        
+        encode_multi_put_rows(listRow, listRowContainerCount, listContainerName, containerCount);
+        //Rows are split into requests within size limit, and the requests are sent in order
+        vector<vector<GSContainerRowEntry> > chunkList;
         try {
-            entryList = new GSContainerRowEntry[containerCount]();
+            vector<GSContainerRowEntry> entryList(containerCount);
+            for (size_t i = 0; i < containerCount; i++) {
+                entryList[i].containerName = listContainerName[i];
+                entryList[i].rowCount = listRowContainerCount[i];
+                entryList[i].rowList = (void* const*) listRow[i];
+            }
+            RequestSplitter::split_row_entries(entryList.empty() ? NULL : &entryList[0],
+                    entryList.size(), mRequestSizeLimit, &chunkList);
         } catch (bad_alloc& ba) {
             throw GSException(mStore, "Memory allocation error");
         }
-        for (int i= 0; i < containerCount; i++) {
-            entryList[i].containerName = listContainerName[i];
-            entryList[i].rowCount = listRowContainerCount[i];
-            entryList[i].rowList = (void* const*) listRow[i];
+        for (size_t i = 0; i < chunkList.size(); i++) {
+            GSResult ret = gsPutMultipleContainerRows(mStore,
+                    chunkList[i].empty() ? NULL : &chunkList[i][0], chunkList[i].size());
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(mStore, ret);
+            }
         }
-        ret = gsPutMultipleContainerRows(mStore, entryList, containerCount);
-        delete[] entryList;
-        if (!GS_SUCCEEDED(ret)) {
-            throw GSException(mStore, ret);
+    }
+
+    /**
+     * @brief Put rows of multiple containers like multi_put, containers are grouped by owner node of their partitions
+     * and the groups are put concurrently by internal connections. Rows of a group exceeding the request size limit
+     * are put by multiple requests in order, while requests of other groups are in flight.
+     * @param ***listRow A pointer refers list of row data
+     * @param *listRowContainerCount A array store number of list row for each container
+     * @param **listContainerName list container name
+     * @param containerCount Number of container
+     * @param parallelism Number of connections used concurrently
+     * @param *errorList Error message for each container, empty if rows of the container were put
+     */
+    void Store::multi_put_parallel(GSRow*** listRow, const int *listRowContainerCount,
+            const char ** listContainerName, size_t containerCount, int parallelism,
+            std::vector<std::string>* errorList) {
+        assert(listRowContainerCount != NULL);
+        assert(listContainerName != NULL);
+        assert(errorList != NULL);
+        if (parallelism < 1) {
+            throw GSException(mStore, "Parallelism must be greater than 0");
+        }
+        encode_multi_put_rows(listRow, listRowContainerCount, listContainerName, containerCount);
+
+        //Group containers by owner node, partition index is used if owner is unknown
+        PartitionController* partitionController = get_partition_controller();
+        vector<vector<GSContainerRowEntry> > groupList;
+        vector<vector<size_t> > groupIndexList;
+        //Requests of each group, they are sent in order by one connection
+        vector<vector<vector<GSContainerRowEntry> > > groupChunkList;
+        try {
+            errorList->assign(containerCount, string());
+            map<int32_t, string> ownerMap;
+            map<string, size_t> groupMap;
+            for (size_t i = 0; i < containerCount; i++) {
+                int32_t partition = partitionController->partition_of(listContainerName[i]);
+                map<int32_t, string>::iterator owner = ownerMap.find(partition);
+                if (owner == ownerMap.end()) {
+                    const GSChar* address = NULL;
+                    GSResult ret = gsGetPartitionOwnerHost(partitionController->mController,
+                            partition, &address);
+                    string key;
+                    if (GS_SUCCEEDED(ret) && address != NULL) {
+                        key = address;
+                    } else {
+                        char buffer[32];
+                        snprintf(buffer, sizeof(buffer), "#%d", partition);
+                        key = buffer;
+                    }
+                    owner = ownerMap.insert(make_pair(partition, key)).first;
+                }
+                map<string, size_t>::iterator group = groupMap.find(owner->second);
+                if (group == groupMap.end()) {
+                    group = groupMap.insert(make_pair(owner->second, groupList.size())).first;
+                    groupList.push_back(vector<GSContainerRowEntry>());
+                    groupIndexList.push_back(vector<size_t>());
+                }
+                GSContainerRowEntry entry = GS_CONTAINER_ROW_ENTRY_INITIALIZER;
+                entry.containerName = listContainerName[i];
+                entry.rowCount = listRowContainerCount[i];
+                entry.rowList = (void* const*) listRow[i];
+                groupList[group->second].push_back(entry);
+                groupIndexList[group->second].push_back(i);
+            }
+            groupChunkList.resize(groupList.size());
+            for (size_t group = 0; group < groupList.size(); group++) {
+                RequestSplitter::split_row_entries(&groupList[group][0], groupList[group].size(),
+                        mRequestSizeLimit, &groupChunkList[group]);
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        int groupCount = (int) groupList.size();
+        if (groupCount == 0) {
+            return;
+        }
+
+        int workerCount = parallelism;
+        if (workerCount > MAX_WORKER_STORE_COUNT) {
+            workerCount = MAX_WORKER_STORE_COUNT;
+        }
+        if (workerCount > groupCount) {
+            workerCount = groupCount;
+        }
+        //One group is put by this Store without internal connection
+        vector<GSGridStore*> storeList(1, mStore);
+        vector<string> groupErrorList;
+        vector<thread> threadList;
+        try {
+            if (workerCount > 1) {
+                open_worker_store_list(workerCount);
+                storeList.assign(mWorkerStoreList.begin(), mWorkerStoreList.begin() + workerCount);
+            }
+            groupErrorList.resize(groupCount);
+            threadList.reserve(workerCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        atomic<int> nextGroup(0);
+        atomic<bool> memoryError(false);
+        auto worker = [&](int index) {
+            while (true) {
+                int group = nextGroup++;
+                if (group >= groupCount) {
+                    return;
+                }
+                vector<vector<GSContainerRowEntry> >& chunkList = groupChunkList[group];
+                for (size_t i = 0; i < chunkList.size(); i++) {
+                    GSResult ret = gsPutMultipleContainerRows(storeList[index], &chunkList[i][0],
+                            chunkList[i].size());
+                    if (!GS_SUCCEEDED(ret)) {
+                        try {
+                            //Error information of a connection is valid until next call for it
+                            GSException exception(storeList[index], ret);
+                            groupErrorList[group] = exception.what();
+                        } catch (bad_alloc& ba) {
+                            memoryError = true;
+                        }
+                        break;
+                    }
+                }
+            }
+        };
+        for (int i = 1; i < workerCount; i++) {
+            try {
+                threadList.push_back(thread(worker, i));
+            } catch (...) {
+                //Remaining groups are processed by started threads and current thread
+                break;
+            }
+        }
+        worker(0);
+        for (size_t i = 0; i < threadList.size(); i++) {
+            threadList[i].join();
+        }
+        if (memoryError) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        for (int group = 0; group < groupCount; group++) {
+            if (groupErrorList[group].empty()) {
+                continue;
+            }
+            for (size_t i = 0; i < groupIndexList[group].size(); i++) {
+                (*errorList)[groupIndexList[group][i]] = groupErrorList[group];
+            }
+        }
+    }
+
+    /**
+     * Get pointer to row key value of a field converted for the row key type
+     */
+    static const void* get_row_key_pointer(const Field& key) {
+        switch (key.type) {
+        case GS_TYPE_STRING:
+            return &key.value.asString;
+        case GS_TYPE_INTEGER:
+            return &key.value.asInteger;
+        case GS_TYPE_LONG:
+            return &key.value.asLong;
+        case GS_TYPE_TIMESTAMP:
+            return &key.value.asTimestamp;
+        default:
+            return NULL;
+        }
+    }
+
+    /**
+     * @brief Create or update multiple containers and create indexes on each of them.
+     * Containers are processed concurrently by internal connections, an error of one container does not stop the others.
+     * @param **infoList Container information of each container
+     * @param infoCount Number of containers
+     * @param *indexList Indexes created on each container
+     * @param indexCount Number of indexes
+     * @param modifiable Indicates whether the column layout of the existing Container can be modified or not
+     * @param parallelism Number of connections used concurrently
+     * @param *errorList Error message of each container, empty if succeeded
+     */
+    void Store::put_containers(ContainerInfo* const* infoList, size_t infoCount,
+            const GSIndexInfo* indexList, size_t indexCount, bool modifiable,
+            int parallelism, std::vector<std::string>* errorList) {
+        assert(errorList != NULL);
+        if (parallelism < 1) {
+            throw GSException(mStore, "Parallelism must be greater than 0");
+        }
+        vector<GSContainerInfo*> gsInfoList;
+        try {
+            errorList->assign(infoCount, string());
+            gsInfoList.resize(infoCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        for (size_t i = 0; i < infoCount; i++) {
+            if (infoList[i] == NULL) {
+                throw GSException(mStore, "Invalid input for \"Store::put_containers\" method. Argument container info can not be null");
+            }
+            gsInfoList[i] = infoList[i]->gs_info();
+        }
+        int taskCount = (int) infoCount;
+        if (taskCount == 0) {
+            return;
+        }
+
+        int workerCount = parallelism;
+        if (workerCount > MAX_WORKER_STORE_COUNT) {
+            workerCount = MAX_WORKER_STORE_COUNT;
+        }
+        if (workerCount > taskCount) {
+            workerCount = taskCount;
+        }
+        //Only one worker uses this Store without internal connection
+        vector<GSGridStore*> storeList(1, mStore);
+        vector<thread> threadList;
+        try {
+            if (workerCount > 1) {
+                open_worker_store_list(workerCount);
+                storeList.assign(mWorkerStoreList.begin(), mWorkerStoreList.begin() + workerCount);
+            }
+            threadList.reserve(workerCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        atomic<int> nextTask(0);
+        atomic<bool> memoryError(false);
+        auto worker = [&](int index) {
+            try {
+                while (!memoryError) {
+                    int task = nextTask++;
+                    if (task >= taskCount) {
+                        break;
+                    }
+                    GSContainerInfo* gsInfo = gsInfoList[task];
+                    GSContainer* gsContainer = NULL;
+                    GSResult ret = gsPutContainerGeneral(storeList[index], gsInfo->name, gsInfo,
+                            modifiable, &gsContainer);
+                    if (!GS_SUCCEEDED(ret)) {
+                        GSException exception(storeList[index], ret);
+                        (*errorList)[task] = exception.what();
+                        continue;
+                    }
+                    for (size_t i = 0; i < indexCount; i++) {
+                        if (indexList[i].name != NULL) {
+                            ret = gsCreateIndexDetail(gsContainer, &indexList[i]);
+                        } else {
+                            ret = gsCreateIndex(gsContainer, indexList[i].columnName, indexList[i].type);
+                        }
+                        if (!GS_SUCCEEDED(ret)) {
+                            GSException exception(gsContainer, ret);
+                            (*errorList)[task] = exception.what();
+                            break;
+                        }
+                    }
+                    gsCloseContainer(&gsContainer, GS_FALSE);
+                }
+            } catch (bad_alloc& ba) {
+                memoryError = true;
+            }
+        };
+        for (int i = 1; i < workerCount; i++) {
+            try {
+                threadList.push_back(thread(worker, i));
+            } catch (...) {
+                //Remaining tasks are processed by started threads and current thread
+                break;
+            }
+        }
+        worker(0);
+        for (size_t i = 0; i < threadList.size(); i++) {
+            threadList[i].join();
+        }
+
+        //Schema may be changed, and compression setting is remembered in the same way as put_container
+        try {
+            for (size_t i = 0; i < infoCount; i++) {
+                mSchemaCache.invalidate(gsInfoList[i]->name);
+                if (!(*errorList)[i].empty()) {
+                    continue;
+                }
+                const int* compressionList = infoList[i]->get_compression_list();
+                string key = Util::to_lower(gsInfoList[i]->name);
+                if (compressionList != NULL) {
+                    mCompressionMap[key].assign(compressionList, compressionList + gsInfoList[i]->columnCount);
+                } else {
+                    mCompressionMap.erase(key);
+                }
+            }
+        } catch (bad_alloc& ba) {
+            memoryError = true;
+        }
+        if (memoryError) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+    }
+
+    /**
+     * @brief Delete rows of multiple containers by row keys. Keys are divided into tasks
+     * and the tasks are processed concurrently by internal connections.
+     * @param **nameList Container names
+     * @param **keyLists Row keys of each container
+     * @param *keyCountList Number of row keys of each container
+     * @param containerCount Number of containers
+     * @param parallelism Number of connections used concurrently
+     * @param *countList Number of rows which existed for each container
+     */
+    void Store::multi_remove(const char* const* nameList, Field* const* keyLists,
+            const size_t* keyCountList, size_t containerCount, int parallelism,
+            std::vector<int64_t>* countList) {
+        assert(countList != NULL);
+        if (parallelism < 1) {
+            throw GSException(mStore, "Parallelism must be greater than 0");
+        }
+        //Container index and start position of keys of each task
+        vector<pair<size_t, size_t> > taskList;
+        try {
+            countList->assign(containerCount, 0);
+            for (size_t i = 0; i < containerCount; i++) {
+                for (size_t start = 0; start < keyCountList[i]; start += MULTI_REMOVE_TASK_KEY_COUNT) {
+                    taskList.push_back(make_pair(i, start));
+                }
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        int taskCount = (int) taskList.size();
+        if (taskCount == 0) {
+            return;
+        }
+
+        int workerCount = parallelism;
+        if (workerCount > MAX_WORKER_STORE_COUNT) {
+            workerCount = MAX_WORKER_STORE_COUNT;
+        }
+        if (workerCount > taskCount) {
+            workerCount = taskCount;
+        }
+        //Only one worker uses this Store without internal connection
+        vector<GSGridStore*> storeList(1, mStore);
+        vector<string> workerErrorList;
+        vector<vector<int64_t> > workerCountList;
+        vector<thread> threadList;
+        try {
+            if (workerCount > 1) {
+                open_worker_store_list(workerCount);
+                storeList.assign(mWorkerStoreList.begin(), mWorkerStoreList.begin() + workerCount);
+            }
+            workerErrorList.resize(workerCount);
+            workerCountList.assign(workerCount, vector<int64_t>(containerCount, 0));
+            threadList.reserve(workerCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        atomic<int> nextTask(0);
+        atomic<bool> failed(false);
+        atomic<bool> memoryError(false);
+        auto worker = [&](int index) {
+            //Containers are opened by each connection when its first task for them is processed
+            map<size_t, GSContainer*> containerMap;
+            try {
+                while (!failed) {
+                    int task = nextTask++;
+                    if (task >= taskCount) {
+                        break;
+                    }
+                    size_t container = taskList[task].first;
+                    GSContainer* gsContainer = NULL;
+                    map<size_t, GSContainer*>::iterator it = containerMap.find(container);
+                    if (it != containerMap.end()) {
+                        gsContainer = it->second;
+                    } else {
+                        GSResult ret = gsGetContainerGeneral(storeList[index], nameList[container],
+                                &gsContainer);
+                        if (!GS_SUCCEEDED(ret)) {
+                            GSException exception(storeList[index], ret);
+                            workerErrorList[index] = exception.what();
+                            failed = true;
+                            break;
+                        }
+                        if (gsContainer == NULL) {
+                            workerErrorList[index] = "Container does not exist";
+                            failed = true;
+                            break;
+                        }
+                        containerMap[container] = gsContainer;
+                    }
+                    size_t end = taskList[task].second + MULTI_REMOVE_TASK_KEY_COUNT;
+                    if (end > keyCountList[container]) {
+                        end = keyCountList[container];
+                    }
+                    for (size_t i = taskList[task].second; i < end && !failed; i++) {
+                        GSBool exists = GS_FALSE;
+                        GSResult ret = gsDeleteRow(gsContainer,
+                                get_row_key_pointer(keyLists[container][i]), &exists);
+                        if (!GS_SUCCEEDED(ret)) {
+                            //Error information of a container is valid until next call for it
+                            GSException exception(gsContainer, ret);
+                            workerErrorList[index] = exception.what();
+                            failed = true;
+                            break;
+                        }
+                        if (exists) {
+                            workerCountList[index][container]++;
+                        }
+                    }
+                }
+            } catch (bad_alloc& ba) {
+                memoryError = true;
+                failed = true;
+            }
+            for (map<size_t, GSContainer*>::iterator it = containerMap.begin();
+                    it != containerMap.end(); it++) {
+                gsCloseContainer(&it->second, GS_FALSE);
+            }
+        };
+        for (int i = 1; i < workerCount; i++) {
+            try {
+                threadList.push_back(thread(worker, i));
+            } catch (...) {
+                //Remaining tasks are processed by started threads and current thread
+                break;
+            }
+        }
+        worker(0);
+        for (size_t i = 0; i < threadList.size(); i++) {
+            threadList[i].join();
+        }
+
+        for (int i = 0; i < workerCount; i++) {
+            for (size_t j = 0; j < containerCount; j++) {
+                (*countList)[j] += workerCountList[i][j];
+            }
+        }
+        if (memoryError) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        for (int i = 0; i < workerCount; i++) {
+            if (!workerErrorList[i].empty()) {
+                throw GSException(mStore, workerErrorList[i].c_str());
+            }
         }
     }
 
@@ -274,13 +1013,25 @@ namespace griddb {
             throw GSException(mStore, ret);
         }
 
-        // set data for orderFromInput
-        for (int i = 0; i < length; i++) {
-            for (int j = 0; j < length; j++) {
-                if (strcmp((*predicateList)[i].containerName, (*entryList)[j].containerName) == 0){
-                    (*orderFromInput)[i] = j;
+        // set data for orderFromInput, container name is case insensitive
+        try {
+            unordered_map<string, int> entryIndexMap;
+            entryIndexMap.reserve(*containerCount);
+            for (int j = 0; j < (int) *containerCount; j++) {
+                if ((*entryList)[j].containerName != NULL) {
+                    entryIndexMap[Util::to_lower((*entryList)[j].containerName)] = j;
+                }
+            }
+            for (int i = 0; i < length; i++) {
+                unordered_map<string, int>::iterator it =
+                        entryIndexMap.find(Util::to_lower((*predicateList)[i].containerName));
+                if (it != entryIndexMap.end()) {
+                    (*orderFromInput)[i] = it->second;
                 }
             }
+        } catch (bad_alloc& ba) {
+            this->freeMemoryMultiGet(colNumList, typeList, length, orderFromInput);
+            throw GSException(mStore, "Memory allocation error");
         }
     }
 
@@ -309,37 +1060,411 @@ namespace griddb {
         }
     }
 
+    /**
+     * @brief Set time to live of schema cache which serves get_container and get_container_info
+     * @param ttl Time to live in milliseconds, 0 disables schema cache
+     */
+    void Store::set_schema_cache_ttl(int64_t ttl) {
+        mSchemaCache.set_ttl(ttl);
+    }
+
+    /**
+     * @brief Get time to live of schema cache
+     * @return Time to live in milliseconds, 0 if schema cache is disabled
+     */
+    int64_t Store::get_schema_cache_ttl() {
+        return mSchemaCache.get_ttl();
+    }
+
+    /**
+     * @brief Remove cached container information
+     * @param *name Container name, NULL means all containers
+     */
+    void Store::invalidate_schema_cache(const char* name) {
+        if (name == NULL) {
+            mSchemaCache.clear();
+        } else {
+            mSchemaCache.invalidate(name);
+        }
+    }
+
+    /**
+     * @brief Set upper limit of estimated size of one request for multi_put
+     * @param limit Size in bytes, 0 puts all rows by one request
+     */
+    void Store::set_request_size_limit(int64_t limit) {
+        if (limit < 0) {
+            throw GSException(mStore, "Request size limit must not be negative");
+        }
+        mRequestSizeLimit = limit;
+    }
+
+    /**
+     * @brief Get upper limit of estimated size of one request for multi_put
+     * @return Size in bytes, 0 if requests are not split
+     */
+    int64_t Store::get_request_size_limit() {
+        return mRequestSizeLimit;
+    }
+
+    /**
+     * @brief Estimate the size of a row of a container from its schema
+     * @param *name Container name
+     * @return Estimated size in bytes, variable length fields are counted as a fixed size
+     */
+    int64_t Store::get_estimated_row_size(const char* name) {
+        ContainerSchemaPtr schema = find_container_schema(name);
+        if (!schema) {
+            throw GSException(mStore, "Container does not exist");
+        }
+        return (int64_t) RequestSplitter::estimate_row_size(schema->get_type_list(),
+                schema->get_column_count());
+    }
+
+    /**
+     * @brief Get GSGridStore of Store object to support Store::multi_put
+     * @return Return a pointer which store GSGridStore of store
+     */
+    GSGridStore* Store::getGSStorePtr() {
+        return mStore;
+    }
+
+    /**
+     * Get container schema from schema cache, or from server and store it to schema cache.
+     * Return empty pointer if container does not exist
+     */
+    ContainerSchemaPtr Store::find_container_schema(const char* name) {
+        ContainerSchemaPtr schema = mSchemaCache.get(name);
+        if (schema) {
+            return schema;
+        }
+
+        GSContainerInfo containerInfo = GS_CONTAINER_INFO_INITIALIZER;
+        GSChar bExists;
+        GSResult ret = gsGetContainerInfo(mStore, name, &containerInfo, &bExists);
+        if (!GS_SUCCEEDED(ret)) {
+            throw GSException(mStore, ret);
+        }
+        if (bExists == false) {
+            return ContainerSchemaPtr();
+        }
+        schema = ContainerSchema::create(&containerInfo);
+        mSchemaCache.put(name, schema);
+        return schema;
+    }
+
+    /**
+     * Compress BLOB fields of rows for multi_put if compression is set for the container
+     */
+    void Store::encode_multi_put_rows(GSRow*** listRow, const int *listRowContainerCount,
+            const char ** listContainerName, size_t containerCount) {
+        for (size_t i = 0; i < containerCount; i++) {
+            const int* compressionList = get_compression_list(listContainerName[i]);
+            if (compressionList == NULL) {
+                continue;
+            }
+            try {
+                int columnCount = (int) mCompressionMap[Util::to_lower(listContainerName[i])].size();
+                for (int j = 0; j < listRowContainerCount[i]; j++) {
+                    BlobCodec::encode_row(listRow[i][j], compressionList, columnCount);
+                }
+            } catch (bad_alloc& ba) {
+                throw GSException(mStore, "Memory allocation error");
+            }
+        }
+    }
+
+    /**
+     * Get partition controller owned by Store, it is created at the first call
+     */
+    PartitionController* Store::get_partition_controller() {
+        if (mPartitionController == NULL) {
+            mPartitionController = partition_info();
+        }
+        return mPartitionController;
+    }
+
+    /**
+     * Get client side compression type of columns which was set by put_container
+     */
+    const int* Store::get_compression_list(const char* name) {
+        if (name == NULL || mCompressionMap.empty()) {
+            return NULL;
+        }
+        map<string, vector<int> >::iterator it = mCompressionMap.find(Util::to_lower(name));
+        if (it == mCompressionMap.end() || it->second.empty()) {
+            return NULL;
+        }
+        return &(it->second[0]);
+    }
+
     /**
      * Support multi_get function to put data into colNumList and typeList
      */
     bool Store::setMultiContainerNumList(const GSRowKeyPredicateEntry* const * predicateList,
             int length, int ***colNumList, GSType**** typeList) {
         for (int i = 0; i < length; i++) {
-            Container *tmpContainer;
+            //Only column types are needed, so container is not opened.
+            //Container information is served by schema cache if enabled
+            ContainerSchemaPtr schema;
             try {
-                tmpContainer = this->get_container((*predicateList)[i].containerName);
-            } catch (GSException e) {
+                schema = find_container_schema((*predicateList)[i].containerName);
+            } catch (GSException& e) {
                 return false;
             }
-            if (tmpContainer == NULL) {
+            if (!schema) {
                 return false;
             }
-            (**colNumList)[i] = tmpContainer->getColumnCount();
+            (**colNumList)[i] = schema->get_column_count();
 
             try {
                 //(**typeList)[i] will be freed in freeMemoryMultiGet() function or argout
                 (**typeList)[i] = new GSType[(**colNumList)[i]]();
             } catch (bad_alloc& ba) {
-                delete tmpContainer;
                 return false;
             }
-            
-            for (int j = 0; j < (**colNumList)[i]; j++) {
-                (**typeList)[i][j] = tmpContainer->getGSTypeList()[j];
+
+            memcpy((**typeList)[i], schema->get_type_list(), (**colNumList)[i] * sizeof(GSType));
+        }
+        return true;
+    }
+
+
+    /**
+     * Check container name starts with prefix, ASCII uppercase characters are treated as lowercase
+     */
+    static bool has_prefix(const GSChar* name, const string& lowerPrefix) {
+        for (size_t i = 0; i < lowerPrefix.size(); i++) {
+            char c = name[i];
+            if (c == '\0') {
+                return false;
+            }
+            if (c >= 'A' && c <= 'Z') {
+                c = c - 'A' + 'a';
+            }
+            if (c != lowerPrefix[i]) {
+                return false;
             }
-            delete tmpContainer;
         }
         return true;
     }
 
+    /**
+     * @brief Get container names of partitions concurrently by internal connections
+     * @param partition_start The first partition index
+     * @param partition_end The partition index next to the last one
+     * @param *prefix Only container names start with prefix are returned, it is case insensitive. NULL means all containers
+     * @param parallelism Number of connections used concurrently
+     * @param *partitionNameList Container names of each partition from partition_start
+     */
+    void Store::list_container_names(int32_t partition_start, int32_t partition_end,
+            const char* prefix, int parallelism,
+            std::vector<std::vector<std::string> >* partitionNameList) {
+        assert(partitionNameList != NULL);
+        string lowerPrefix;
+        try {
+            partitionNameList->clear();
+            if (partition_end > partition_start) {
+                partitionNameList->resize(partition_end - partition_start);
+            }
+            if (prefix != NULL) {
+                lowerPrefix = Util::to_lower(prefix);
+            }
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        run_partition_workers(partition_start, partition_end, parallelism,
+                [&](GSPartitionController* controller, int32_t partition) -> GSResult {
+            vector<string>& nameList = (*partitionNameList)[partition - partition_start];
+            int64_t start = 0;
+            int64_t limit = CONTAINER_NAME_PAGE_SIZE;
+            while (true) {
+                const GSChar* const* stringList;
+                size_t size;
+                GSResult ret = gsGetPartitionContainerNames(controller, partition, start, &limit,
+                        &stringList, &size);
+                if (!GS_SUCCEEDED(ret)) {
+                    return ret;
+                }
+                //stringList is valid until next call for controller, so names are copied here
+                for (size_t i = 0; i < size; i++) {
+                    if (has_prefix(stringList[i], lowerPrefix)) {
+                        nameList.push_back(stringList[i]);
+                    }
+                }
+                if ((int64_t) size < limit) {
+                    return GS_RESULT_OK;
+                }
+                start += size;
+            }
+        });
+    }
+
+    /**
+     * @brief Get number of containers of partitions concurrently by internal connections
+     * @param partition_start The first partition index
+     * @param partition_end The partition index next to the last one
+     * @param parallelism Number of connections used concurrently
+     * @param *countList Number of containers of each partition from partition_start
+     */
+    void Store::get_container_counts(int32_t partition_start, int32_t partition_end,
+            int parallelism, std::vector<int64_t>* countList) {
+        assert(countList != NULL);
+        try {
+            countList->assign(partition_end > partition_start ? partition_end - partition_start : 0, 0);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+
+        run_partition_workers(partition_start, partition_end, parallelism,
+                [&](GSPartitionController* controller, int32_t partition) -> GSResult {
+            return gsGetPartitionContainerCount(controller, partition,
+                    &(*countList)[partition - partition_start]);
+        });
+    }
+
+    /**
+     * Keep properties which were used to open this Store
+     */
+    void Store::set_properties(GSGridStoreFactory* factory, const GSPropertyEntry* properties,
+            size_t propertyCount) {
+        mFactory = factory;
+        for (size_t i = 0; i < propertyCount; i++) {
+            mPropertyList.push_back(make_pair(string(properties[i].name), string(properties[i].value)));
+        }
+    }
+
+    /**
+     * Open internal connections with same properties as this Store until there are count connections
+     */
+    void Store::open_worker_store_list(int count) {
+        if (mFactory == NULL) {
+            throw GSException(mStore, "Properties of Store are not available");
+        }
+        if ((int) mWorkerStoreList.size() >= count) {
+            return;
+        }
+        vector<GSPropertyEntry> properties(mPropertyList.size());
+        for (size_t i = 0; i < mPropertyList.size(); i++) {
+            properties[i].name = mPropertyList[i].first.c_str();
+            properties[i].value = mPropertyList[i].second.c_str();
+        }
+        mWorkerStoreList.reserve(count);
+        while ((int) mWorkerStoreList.size() < count) {
+            GSGridStore* workerStore;
+            GSResult ret = gsGetGridStore(mFactory, properties.empty() ? NULL : &properties[0],
+                    properties.size(), &workerStore);
+            if (!GS_SUCCEEDED(ret)) {
+                throw GSException(mFactory, ret);
+            }
+            mWorkerStoreList.push_back(workerStore);
+        }
+    }
+
+    /**
+     * Close all internal connections
+     */
+    void Store::close_worker_store_list() {
+        for (size_t i = 0; i < mWorkerStoreList.size(); i++) {
+            gsCloseGridStore(&mWorkerStoreList[i], GS_FALSE);
+        }
+        mWorkerStoreList.clear();
+    }
+
+    /**
+     * Run task for each partition in [partitionStart, partitionEnd) on parallelism threads.
+     * Each thread uses its own internal connection, partitions are assigned to a thread which becomes free.
+     * The first error is thrown after all threads finish.
+     */
+    void Store::run_partition_workers(int32_t partitionStart, int32_t partitionEnd, int parallelism,
+            function<GSResult(GSPartitionController*, int32_t)> task) {
+        if (partitionEnd <= partitionStart) {
+            return;
+        }
+        if (parallelism < 1) {
+            throw GSException(mStore, "Parallelism must be greater than 0");
+        }
+        int workerCount = parallelism;
+        if (workerCount > MAX_WORKER_STORE_COUNT) {
+            workerCount = MAX_WORKER_STORE_COUNT;
+        }
+        if (workerCount > partitionEnd - partitionStart) {
+            workerCount = partitionEnd - partitionStart;
+        }
+
+        vector<GSPartitionController*> controllerList;
+        vector<GSResult> resultList;
+        vector<thread> threadList;
+        try {
+            open_worker_store_list(workerCount);
+            controllerList.assign(workerCount, NULL);
+            resultList.assign(workerCount, GS_RESULT_OK);
+            threadList.reserve(workerCount);
+        } catch (bad_alloc& ba) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+        for (int i = 0; i < workerCount; i++) {
+            GSResult ret = gsGetPartitionController(mWorkerStoreList[i], &controllerList[i]);
+            if (!GS_SUCCEEDED(ret)) {
+                GSException exception(mWorkerStoreList[i], ret);
+                for (int j = 0; j < i; j++) {
+                    gsClosePartitionController(&controllerList[j]);
+                }
+                throw GSException(&exception);
+            }
+        }
+
+        atomic<int32_t> nextPartition(partitionStart);
+        atomic<bool> failed(false);
+        atomic<bool> memoryError(false);
+        auto worker = [&](int index) {
+            while (!failed) {
+                int32_t partition = nextPartition++;
+                if (partition >= partitionEnd) {
+                    return;
+                }
+                try {
+                    resultList[index] = task(controllerList[index], partition);
+                } catch (bad_alloc& ba) {
+                    memoryError = true;
+                    failed = true;
+                    return;
+                }
+                if (!GS_SUCCEEDED(resultList[index])) {
+                    failed = true;
+                    return;
+                }
+            }
+        };
+        for (int i = 1; i < workerCount; i++) {
+            try {
+                threadList.push_back(thread(worker, i));
+            } catch (...) {
+                //Remaining partitions are processed by started threads and current thread
+                break;
+            }
+        }
+        worker(0);
+        for (size_t i = 0; i < threadList.size(); i++) {
+            threadList[i].join();
+        }
+
+        for (int i = 0; i < workerCount; i++) {
+            if (!GS_SUCCEEDED(resultList[i])) {
+                //Keep error information before closing controllers
+                GSException exception(controllerList[i], resultList[i]);
+                for (int j = 0; j < workerCount; j++) {
+                    gsClosePartitionController(&controllerList[j]);
+                }
+                throw GSException(&exception);
+            }
+        }
+        for (int i = 0; i < workerCount; i++) {
+            gsClosePartitionController(&controllerList[i]);
+        }
+        if (memoryError) {
+            throw GSException(mStore, "Memory allocation error");
+        }
+    }
 }
@@ -18,7 +18,10 @@
 #define _STORE_H_
 
 #include <map>
+#include <unordered_map>
 #include <vector>
+#include <string>
+#include <functional>
 #include <assert.h>
 
 #include "ContainerInfo.h"
@@ -26,6 +29,15 @@
 #include "PartitionController.h"
 #include "RowKeyPredicate.h"
 #include "GSException.h"
+#include "SchemaCache.h"
+#include "RequestSplitter.h"
+
+//Upper limit of internal connections used by parallel partition operations
+#define MAX_WORKER_STORE_COUNT 32
+//Number of container names requested at once by gsGetPartitionContainerNames
+#define CONTAINER_NAME_PAGE_SIZE 10000
+//Number of row keys deleted by one task of multi_remove
+#define MULTI_REMOVE_TASK_KEY_COUNT 1024
 
 using namespace std;
 
@@ -34,6 +46,21 @@ namespace griddb {
 class Store {
     GSGridStore *mStore;
 
+    //Client side compression type of columns for each container, key is lowercase container name
+    map<string, vector<int> > mCompressionMap;
+
+    SchemaCache mSchemaCache;
+
+    //Factory and properties used to open internal connections for parallel partition operations
+    GSGridStoreFactory* mFactory;
+    vector<pair<string, string> > mPropertyList;
+    //Internal connections, they are opened on demand and closed with Store
+    vector<GSGridStore*> mWorkerStoreList;
+    //Partition controller kept to reuse computed partition index, it is created on demand
+    PartitionController* mPartitionController;
+    //Upper limit of estimated size of one request for multi_put, 0 if requests are not split
+    int64_t mRequestSizeLimit;
+
     friend class StoreFactory;
 
     public:
@@ -46,8 +73,19 @@ class Store {
         void drop_container(const char *name);
 
         void fetch_all(GSQuery* const * queryList, size_t queryCount);
+        void fetch_all_by_group(Query* const* queryList, const size_t* groupSizeList, size_t groupCount,
+                int parallelism, std::vector<int>* groupOrderList, std::vector<RowSet*>* rowSetList);
         void multi_put(GSRow*** listRow, const int *listRowContainerCount,
                 const char ** listContainerName, size_t containerCount);
+        void multi_put_parallel(GSRow*** listRow, const int *listRowContainerCount,
+                const char ** listContainerName, size_t containerCount, int parallelism,
+                std::vector<std::string>* errorList);
+        void put_containers(ContainerInfo* const* infoList, size_t infoCount,
+                const GSIndexInfo* indexList, size_t indexCount, bool modifiable,
+                int parallelism, std::vector<std::string>* errorList);
+        void multi_remove(const char* const* nameList, Field* const* keyLists,
+                const size_t* keyCountList, size_t containerCount, int parallelism,
+                std::vector<int64_t>* countList);
         void multi_get(const GSRowKeyPredicateEntry* const * predicateList,
                 size_t predicateCount, GSContainerRowEntry **entryList, size_t* containerCount,
                 int **colNumList, GSType*** typeList, int **orderFromInput);
@@ -55,10 +93,33 @@ class Store {
         ContainerInfo* get_container_info(const char *name);
         PartitionController* partition_info();
         RowKeyPredicate* create_row_key_predicate(GSType type);
+        void set_schema_cache_ttl(int64_t ttl);
+        int64_t get_schema_cache_ttl();
+        void invalidate_schema_cache(const char* name = NULL);
+        void set_request_size_limit(int64_t limit);
+        int64_t get_request_size_limit();
+        int64_t get_estimated_row_size(const char* name);
+        bool refresh_container(Container* container, bool force = false);
+        GSGridStore* getGSStorePtr();
+        void list_container_names(int32_t partition_start, int32_t partition_end,
+                const char* prefix, int parallelism,
+                std::vector<std::vector<std::string> >* partitionNameList);
+        void get_container_counts(int32_t partition_start, int32_t partition_end,
+                int parallelism, std::vector<int64_t>* countList);
 
     private:
         Store(GSGridStore* store);
         void freeMemoryMultiGet(int** colNumList, GSType*** typeList, int length, int** orderFromInput);
+        const int* get_compression_list(const char* name);
+        void encode_multi_put_rows(GSRow*** listRow, const int *listRowContainerCount,
+                const char ** listContainerName, size_t containerCount);
+        PartitionController* get_partition_controller();
+        ContainerSchemaPtr find_container_schema(const char* name);
+        void set_properties(GSGridStoreFactory* factory, const GSPropertyEntry* properties, size_t propertyCount);
+        void open_worker_store_list(int count);
+        void close_worker_store_list();
+        void run_partition_workers(int32_t partitionStart, int32_t partitionEnd, int parallelism,
+                function<GSResult(GSPartitionController*, int32_t)> task);
         bool setMultiContainerNumList(const GSRowKeyPredicateEntry* const * predicateList,
                 int length, int*** colNumList, GSType**** typeList);
 };
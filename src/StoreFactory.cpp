@@ -153,14 +153,22 @@ namespace griddb {
             throw GSException(mFactory, ret);
         }
 
+        Store* store;
         try {
             //return new Store(store);
-            Store* store = new Store(gsStore);
-            return store;
+            store = new Store(gsStore);
         } catch (bad_alloc& ba) {
             gsCloseGridStore(&gsStore, GS_FALSE);
             throw GSException(mFactory, "Memory allocation error");
         }
+        try {
+            //Keep properties to open internal connections of Store
+            store->set_properties(mFactory, local_props, index);
+        } catch (bad_alloc& ba) {
+            delete store;
+            throw GSException(mFactory, "Memory allocation error");
+        }
+        return store;
     }
 
     /**
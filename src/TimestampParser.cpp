@@ -0,0 +1,213 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include "TimestampParser.h"
+
+//Length of "YYYY-MM-DDThh:mm:ss.SSSZ"
+#define TIMESTAMP_UTC_LENGTH 24
+//Length of "YYYY-MM-DDThh:mm:ss.SSS+hh:mm"
+#define TIMESTAMP_OFFSET_LENGTH 29
+
+namespace griddb {
+
+    //Layout of the fixed part "YYYY-MM-DDThh:mm:ss.SSS?" split into 3 words of 8 bytes.
+    //Position 23 (time zone designator) is checked separately.
+    static const char TIMESTAMP_TEMPLATE[24] = {
+        '0', '0', '0', '0', '-', '0', '0', '-',
+        '0', '0', 'T', '0', '0', ':', '0', '0',
+        ':', '0', '0', '.', '0', '0', '0', '\0'};
+    static const unsigned char DIGIT_MASK[24] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+        0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+        0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00};
+    static const unsigned char SEPARATOR_MASK[24] = {
+        0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+        0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00};
+    static const uint64_t BYTE_HIGH_NIBBLE = 0xF0F0F0F0F0F0F0F0ULL;
+    static const uint64_t BYTE_ZERO_CHAR = 0x3030303030303030ULL;
+    static const uint64_t BYTE_SIX = 0x0606060606060606ULL;
+
+    static inline uint64_t load64(const void* ptr) {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Check 8 characters at once: digit positions must be '0'-'9', separator positions must match the template
+     */
+    static inline bool check_word(const GSChar* str, int word) {
+        uint64_t value = load64(str + word * 8);
+        uint64_t digitMask = load64(DIGIT_MASK + word * 8);
+        uint64_t separatorMask = load64(SEPARATOR_MASK + word * 8);
+        uint64_t digits = (value & digitMask) | (BYTE_ZERO_CHAR & ~digitMask);
+
+        if ((digits & BYTE_HIGH_NIBBLE) != BYTE_ZERO_CHAR) {
+            return false;
+        }
+        if (((digits + BYTE_SIX) & BYTE_HIGH_NIBBLE) != BYTE_ZERO_CHAR) {
+            return false;
+        }
+        return (value & separatorMask) == (load64(TIMESTAMP_TEMPLATE + word * 8) & separatorMask);
+    }
+
+    static inline int to_int2(const GSChar* str) {
+        return (str[0] - '0') * 10 + (str[1] - '0');
+    }
+
+    static inline bool is_leap_year(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    /**
+     * Number of days from 1970-01-01 to the specified civil date
+     */
+    static inline int64_t days_from_civil(int year, int month, int day) {
+        year -= (month <= 2);
+        const int64_t era = year / 400;
+        const int64_t yoe = year - era * 400;
+        const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    /**
+     * @brief Parse one timestamp string
+     * @param *str Timestamp string, it does not need to be null-terminated
+     * @param length Length of timestamp string
+     * @param *timestamp The pointer to a variable to store the parsed timestamp
+     * @return Return true if the string can be parsed
+     */
+    bool TimestampParser::parse(const GSChar* str, size_t length, GSTimestamp* timestamp) {
+        if (str == NULL) {
+            return false;
+        }
+        if (parse_fixed(str, length, timestamp)) {
+            return true;
+        }
+        return parse_fallback(str, length, timestamp);
+    }
+
+    /**
+     * @brief Parse a list of timestamp strings stored continuously in one buffer
+     * @param *buffer Buffer stores all timestamp strings
+     * @param *offsetList Start offset of each string in buffer, it has count + 1 elements
+     * @param count Number of timestamp strings
+     * @param *timestampList The array to store parsed timestamps
+     * @return Number of strings parsed before the first one which can not be parsed
+     */
+    size_t TimestampParser::parse_list(const GSChar* buffer, const size_t* offsetList,
+            size_t count, GSTimestamp* timestampList) {
+        for (size_t i = 0; i < count; i++) {
+            const GSChar* str = buffer + offsetList[i];
+            size_t length = offsetList[i + 1] - offsetList[i];
+            if (!parse_fixed(str, length, &timestampList[i]) &&
+                    !parse_fallback(str, length, &timestampList[i])) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Parse fixed format "YYYY-MM-DDThh:mm:ss.SSSZ" and "YYYY-MM-DDThh:mm:ss.SSS+hh:mm".
+     * Return false for any other input so that gsParseTime() decides the result.
+     */
+    bool TimestampParser::parse_fixed(const GSChar* str, size_t length, GSTimestamp* timestamp) {
+        if (length != TIMESTAMP_UTC_LENGTH && length != TIMESTAMP_OFFSET_LENGTH) {
+            return false;
+        }
+        if (!check_word(str, 0) || !check_word(str, 1) || !check_word(str, 2)) {
+            return false;
+        }
+
+        int64_t offsetMinute = 0;
+        if (length == TIMESTAMP_UTC_LENGTH) {
+            if (str[23] != 'Z') {
+                return false;
+            }
+        } else {
+            const GSChar* zone = str + 23;
+            if ((zone[0] != '+' && zone[0] != '-') || zone[3] != ':') {
+                return false;
+            }
+            if (zone[1] < '0' || zone[1] > '9' || zone[2] < '0' || zone[2] > '9' ||
+                    zone[4] < '0' || zone[4] > '9' || zone[5] < '0' || zone[5] > '9') {
+                return false;
+            }
+            int offsetHour = to_int2(zone + 1);
+            int offsetMin = to_int2(zone + 4);
+            if (offsetHour > 23 || offsetMin > 59) {
+                return false;
+            }
+            offsetMinute = offsetHour * 60 + offsetMin;
+            if (zone[0] == '-') {
+                offsetMinute = -offsetMinute;
+            }
+        }
+
+        int year = to_int2(str) * 100 + to_int2(str + 2);
+        int month = to_int2(str + 5);
+        int day = to_int2(str + 8);
+        int hour = to_int2(str + 11);
+        int minute = to_int2(str + 14);
+        int second = to_int2(str + 17);
+        int milliSecond = (str[20] - '0') * 100 + to_int2(str + 21);
+
+        static const int DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (year < 1970 || month < 1 || month > 12 || day < 1 ||
+                hour > 23 || minute > 59 || second > 59) {
+            return false;
+        }
+        int maxDay = DAYS_IN_MONTH[month - 1] + ((month == 2 && is_leap_year(year)) ? 1 : 0);
+        if (day > maxDay) {
+            return false;
+        }
+
+        int64_t seconds = days_from_civil(year, month, day) * 86400 +
+                hour * 3600 + minute * 60 + second - offsetMinute * 60;
+        if (seconds < 0) {
+            return false;
+        }
+        *timestamp = seconds * 1000 + milliSecond;
+        return true;
+    }
+
+    /**
+     * Parse by gsParseTime() which requires null-terminated string
+     */
+    bool TimestampParser::parse_fallback(const GSChar* str, size_t length, GSTimestamp* timestamp) {
+        GSChar stackBuffer[TIMESTAMP_STRING_MAX_LENGTH + 1];
+        GSChar* buffer = stackBuffer;
+        if (length > TIMESTAMP_STRING_MAX_LENGTH) {
+            try {
+                buffer = new GSChar[length + 1];
+            } catch (bad_alloc& ba) {
+                return false;
+            }
+        }
+        memcpy(buffer, str, length);
+        buffer[length] = '\0';
+
+        GSBool ret = gsParseTime(buffer, timestamp);
+        if (buffer != stackBuffer) {
+            delete[] buffer;
+        }
+        return (ret == GS_TRUE);
+    }
+
+} /* namespace griddb */
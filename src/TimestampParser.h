@@ -0,0 +1,52 @@
+/*
+    Copyright (c) 2017 TOSHIBA Digital Solutions Corporation.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef _TIMESTAMP_PARSER_H_
+#define _TIMESTAMP_PARSER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <new>
+
+#include "gridstore.h"
+
+//Upper bound of a string length that can be handled by the fixed-format path
+#define TIMESTAMP_STRING_MAX_LENGTH 32
+
+using namespace std;
+
+namespace griddb {
+
+/**
+ * Parse ISO-8601 / RFC-3339 timestamp strings into GSTimestamp.
+ * The common fixed formats "YYYY-MM-DDThh:mm:ss.SSSZ" and "YYYY-MM-DDThh:mm:ss.SSS+hh:mm"
+ * are parsed without allocation, other formats are delegated to gsParseTime().
+ */
+class TimestampParser {
+    public:
+        static bool parse(const GSChar* str, size_t length, GSTimestamp* timestamp);
+        static size_t parse_list(const GSChar* buffer, const size_t* offsetList,
+                size_t count, GSTimestamp* timestampList);
+
+    private:
+        static bool parse_fixed(const GSChar* str, size_t length, GSTimestamp* timestamp);
+        static bool parse_fallback(const GSChar* str, size_t length, GSTimestamp* timestamp);
+};
+
+} /* namespace griddb */
+
+#endif /* _TIMESTAMP_PARSER_H_ */
@@ -28,4 +28,19 @@ namespace griddb {
         strcpy(temp, from);
         *to = temp;
     }
+
+    /**
+     * @brief Convert ASCII uppercase characters to lowercase, container names are compared in this form
+     * @param *from A pointer stores source string data
+     * @return Converted string
+     */
+    string Util::to_lower(const GSChar* from) {
+        string result(from);
+        for (size_t i = 0; i < result.size(); i++) {
+            if (result[i] >= 'A' && result[i] <= 'Z') {
+                result[i] = result[i] - 'A' + 'a';
+            }
+        }
+        return result;
+    }
 }
@@ -18,6 +18,7 @@
 #define _UTIL_H_
 
 #include <string.h>
+#include <string>
 #include "GSException.h"
 
 using namespace std;
@@ -27,6 +28,7 @@ namespace griddb {
 class Util {
     public:
         static void strdup(const GSChar** const to, const GSChar* from);
+        static string to_lower(const GSChar* from);
 };
 
 }
@@ -18,12 +18,23 @@
 %ignore griddb::Container::getGSTypeList;
 %ignore griddb::Container::getColumnCount;
 %ignore griddb::Container::getGSRowPtr;
+%ignore griddb::Container::acquireRow;
+%ignore griddb::Container::releaseRowList;
 %ignore griddb::ContainerInfo::gs_info;
+%ignore griddb::ContainerInfo::get_compression_list;
+%ignore griddb::ContainerInfo::get_schema;
+%ignore griddb::ContainerInfo::ContainerInfo(const ContainerSchemaPtr& schema);
+%ignore griddb::ContainerSchema;
+%ignore griddb::BlobCodec;
 %ignore griddb::Field;
+%ignore griddb::RowBatch;
+%ignore griddb::SchemaCache;
+%ignore griddb::Store::getGSStorePtr;
 %ignore griddb::Query::gs_ptr;
 %ignore griddb::RowKeyPredicate::gs_ptr;
 %ignore griddb::RowSet::getGSTypeList;
 %ignore griddb::RowSet::getColumnCount;
+%ignore griddb::RowSet::getColumnInfoList;
 %ignore griddb::RowSet::getGSRowPtr;
 %ignore griddb::AggregationResult::AggregationResult;
 %ignore griddb::QueryAnalysisEntry::QueryAnalysisEntry;
@@ -36,6 +47,10 @@
 
 //Mark these methods below return new object, need to be free by target language
 %feature("new") griddb::Container::query;
+%feature("new") griddb::Container::prepare;
+%feature("new") griddb::PreparedQuery::execute;
+%feature("new") griddb::Container::create_blob_writer;
+%feature("new") griddb::Container::get_blob_reader;
 //%feature("new") griddb::ContainerInfo::get_time_series_properties;
 %feature("new") griddb::Query::fetch;
 %feature("new") griddb::Query::get_row_set;
@@ -75,14 +90,23 @@
 #include "GSException.h"
 #include "TimeSeriesProperties.h"
 #include "ExpirationInfo.h"
+#include "ContainerSchema.h"
 #include "ContainerInfo.h"
 #include "Field.h"
+#include "BlobCodec.h"
+#include "BlobWriter.h"
+#include "BlobReader.h"
+#include "TimestampParser.h"
+#include "RowBatch.h"
+#include "RequestSplitter.h"
 #include "QueryAnalysisEntry.h"
 #include "RowSet.h"
 #include "Query.h"
+#include "PreparedQuery.h"
 #include "Container.h"
 #include "PartitionController.h"
 #include "RowKeyPredicate.h"
+#include "SchemaCache.h"
 #include "Store.h"
 #include "StoreFactory.h"
 %}
@@ -104,8 +128,11 @@
 %shared_ptr(griddb::ExpirationInfo)
 %shared_ptr(griddb::ContainerInfo)
 %shared_ptr(griddb::QueryAnalysisEntry)
+%shared_ptr(griddb::BlobWriter)
+%shared_ptr(griddb::BlobReader)
 %shared_ptr(griddb::RowSet)
 %shared_ptr(griddb::Query)
+%shared_ptr(griddb::PreparedQuery)
 %shared_ptr(griddb::Container)
 %shared_ptr(griddb::StoreFactory)
 %shared_ptr(griddb::RowKeyPredicate)
@@ -120,8 +147,11 @@
 %include "ContainerInfo.h"
 %include "Field.h"
 %include "QueryAnalysisEntry.h"
+%include "BlobWriter.h"
+%include "BlobReader.h"
 %include "RowSet.h"
 %include "Query.h"
+%include "PreparedQuery.h"
 %include "Container.h"
 %include "PartitionController.h"
 %include "RowKeyPredicate.h"
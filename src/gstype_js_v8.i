@@ -18,6 +18,7 @@
 %{
 #include <ctime>
 #include <limits>
+#include <vector>
 #include <node_buffer.h>
 #include <nan.h>
 %}
@@ -421,6 +422,15 @@ static bool convertObjectToGSTimestamp(v8::Local<v8::Value> value, GSTimestamp*
         *timestamp = value->NumberValue(Nan::GetCurrentContext()).FromJust();
         return true;
     } else if (value->IsString()) {
+        v8::Local<v8::String> str = v8::Local<v8::String>::Cast(value);
+        int length = str->Length();
+        if (str->IsOneByte() && length <= TIMESTAMP_STRING_MAX_LENGTH) {
+            // Read characters of one-byte string directly, no allocation is needed
+            GSChar buffer[TIMESTAMP_STRING_MAX_LENGTH];
+            str->WriteOneByte(v8::Isolate::GetCurrent(), (uint8_t*) buffer, 0, length,
+                    v8::String::NO_NULL_TERMINATION);
+            return griddb::TimestampParser::parse(buffer, length, timestamp);
+        }
 
         // Input is datetime string: ex
         res = SWIG_AsCharPtrAndSize(value, &v, &size, &alloc);
@@ -429,9 +439,9 @@ static bool convertObjectToGSTimestamp(v8::Local<v8::Value> value, GSTimestamp*
            return false;
         }
 
-        retConvertTimestamp = gsParseTime(v, timestamp);
+        retConvertTimestamp = griddb::TimestampParser::parse(v, strlen(v), timestamp);
         cleanString(v, alloc);
-        return (retConvertTimestamp == GS_TRUE);
+        return retConvertTimestamp;
     } else if (value->IsNumber()) {
         *timestamp = value->NumberValue(Nan::GetCurrentContext()).FromJust();
         if (*timestamp > (UTC_TIMESTAMP_MAX * 1000)) { //miliseconds
@@ -445,6 +455,61 @@ static bool convertObjectToGSTimestamp(v8::Local<v8::Value> value, GSTimestamp*
 }
 }
 
+/**
+ * Support convert type from array object to list of GSTimestamp.
+ * Short one-byte strings are collected into one buffer and parsed together
+ */
+%fragment("convertObjectToGSTimestampArray", "header", fragment = "convertObjectToGSTimestamp") {
+static bool convertObjectToGSTimestampArray(v8::Local<v8::Array> arr, size_t size, GSTimestamp* timestampList) {
+    std::vector<GSChar> buffer;
+    std::vector<size_t> offsetList;
+    std::vector<size_t> indexList;
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+
+    try {
+        buffer.resize(size * TIMESTAMP_STRING_MAX_LENGTH + 1);
+        offsetList.reserve(size + 1);
+        indexList.reserve(size);
+        offsetList.push_back(0);
+        for (size_t i = 0; i < size; i++) {
+            v8::Local<v8::Value> value = arr->Get(context, i).ToLocalChecked();
+            if (value->IsString()) {
+                v8::Local<v8::String> str = v8::Local<v8::String>::Cast(value);
+                int length = str->Length();
+                if (str->IsOneByte() && length <= TIMESTAMP_STRING_MAX_LENGTH) {
+                    size_t offset = offsetList.back();
+                    str->WriteOneByte(isolate, (uint8_t*) &buffer[offset], 0, length,
+                            v8::String::NO_NULL_TERMINATION);
+                    offsetList.push_back(offset + length);
+                    indexList.push_back(i);
+                    continue;
+                }
+            }
+            if (!convertObjectToGSTimestamp(value, &timestampList[i])) {
+                return false;
+            }
+        }
+        if (indexList.empty()) {
+            return true;
+        }
+
+        std::vector<GSTimestamp> parsedList(indexList.size());
+        size_t parsedCount = griddb::TimestampParser::parse_list(&buffer[0], &offsetList[0],
+                indexList.size(), &parsedList[0]);
+        if (parsedCount != indexList.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < indexList.size(); i++) {
+            timestampList[indexList[i]] = parsedList[i];
+        }
+    } catch (std::bad_alloc& ba) {
+        return false;
+    }
+    return true;
+}
+}
+
 /**
  * Support convert row key Field from NodeJS object to C Object with specific type
  */
@@ -503,11 +568,92 @@ static bool convertToRowKeyFieldWithType(griddb::Field &field, v8::Local<v8::Val
 }
 }
 
+/**
+ * Convert row keys for multi_remove from array, or from typed array without converting each element:
+ * Int32Array for INTEGER key, BigInt64Array and Float64Array of integer values for LONG and TIMESTAMP key.
+ * keyList may be allocated even if conversion fails, it is released by caller.
+ */
+%fragment("convertToRowKeyFieldList", "header", fragment = "convertToRowKeyFieldWithType") {
+static bool convertToRowKeyFieldList(v8::Local<v8::Value> value, GSType type,
+        griddb::Field** keyList, size_t* keyCount, const char** errorMsg) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    *keyList = NULL;
+    *keyCount = 0;
+    if (value->IsArray()) {
+        v8::Local<v8::Array> arr = v8::Local<v8::Array>::Cast(value);
+        size_t length = (size_t) arr->Length();
+        try {
+            *keyList = new griddb::Field[length]();
+        } catch (std::bad_alloc& ba) {
+            *errorMsg = "Memory allocation error";
+            return false;
+        }
+        *keyCount = length;
+        for (size_t i = 0; i < length; i++) {
+            if (!convertToRowKeyFieldWithType((*keyList)[i], arr->Get(context, i).ToLocalChecked(), type)) {
+                *errorMsg = "Can not convert to row key field";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool int32Key = value->IsInt32Array() && type == GS_TYPE_INTEGER;
+    bool int64Key = (value->IsBigInt64Array() || value->IsFloat64Array()) &&
+            (type == GS_TYPE_LONG || type == GS_TYPE_TIMESTAMP);
+    if (!int32Key && !int64Key) {
+        *errorMsg = "Expected array or typed array of row keys matching the row key type";
+        return false;
+    }
+    v8::Local<v8::TypedArray> arr = v8::Local<v8::TypedArray>::Cast(value);
+    size_t length = arr->Length();
+    std::vector<char> buffer;
+    try {
+        *keyList = new griddb::Field[length]();
+        buffer.resize(arr->ByteLength());
+    } catch (std::bad_alloc& ba) {
+        *errorMsg = "Memory allocation error";
+        return false;
+    }
+    *keyCount = length;
+    if (!buffer.empty()) {
+        arr->CopyContents(&buffer[0], buffer.size());
+    }
+    for (size_t i = 0; i < length; i++) {
+        griddb::Field& field = (*keyList)[i];
+        field.type = type;
+        if (int32Key) {
+            memcpy(&field.value.asInteger, &buffer[i * sizeof(int32_t)], sizeof(int32_t));
+            continue;
+        }
+        int64_t key;
+        if (value->IsBigInt64Array()) {
+            memcpy(&key, &buffer[i * sizeof(int64_t)], sizeof(int64_t));
+        } else {
+            double number;
+            memcpy(&number, &buffer[i * sizeof(double)], sizeof(double));
+            //Same range as convertObjectToLong
+            if (number != floor(number) || number < -9007199254740992.0 || number > 9007199254740992.0) {
+                *errorMsg = "Row key must be an integer";
+                return false;
+            }
+            key = (int64_t) number;
+        }
+        if (type == GS_TYPE_LONG) {
+            field.value.asLong = key;
+        } else {
+            field.value.asTimestamp = key;
+        }
+    }
+    return true;
+}
+}
+
 %fragment("convertToFieldWithType", "header", fragment = "SWIG_AsCharPtrAndSize",
         fragment = "convertObjectToDouble", fragment = "convertObjectToGSTimestamp", 
         fragment = "convertObjectToBool", fragment = "convertObjectToFloat", 
         fragment = "convertObjectToStringArray", fragment = "cleanString",
-        fragment = "convertObjectToLong") {
+        fragment = "convertObjectToLong", fragment = "convertObjectToGSTimestampArray") {
 static bool convertToFieldWithType(GSRow *row, int column, v8::Local<v8::Value> value, GSType type) {
     int32_t intVal;
     size_t size;
@@ -857,15 +1003,10 @@ static bool convertToFieldWithType(GSRow *row, int column, v8::Local<v8::Value>
             } catch (std::bad_alloc& ba) {
                 return false;
             }
-            bool checkRet;
-            for (i = 0; i < size; i++) {
-                v8::Local<v8::Value> value = arr->Get(context, i).ToLocalChecked();
-                checkRet = convertObjectToGSTimestamp(value, (timestampArrVal + i));
-                if (!checkRet) {
-                    delete[] timestampArrVal;
-                    timestampArrVal = NULL;
-                    return false;
-                }
+            if (!convertObjectToGSTimestampArray(arr, size, timestampArrVal)) {
+                delete[] timestampArrVal;
+                timestampArrVal = NULL;
+                return false;
             }
             ret = gsSetRowFieldByTimestampArray(row, column, (const GSTimestamp *)timestampArrVal, size);
             delete[] timestampArrVal;
@@ -1053,6 +1194,70 @@ static void freeargGetStore(const char* host, const char* cluster_name,
     }
 }
 
+/**
+* Typemaps for Store.fetch_all_by_group(): array of groups, each group is an array of Query
+*/
+%typemap(in) (griddb::Query* const* queryList, const size_t* groupSizeList, size_t groupCount)
+        (v8::Local<v8::Array> arr, v8::Local<v8::Array> group, griddb::Query *vquery, int res = 0,
+        std::vector<griddb::Query*> queryList1, std::vector<size_t> groupSizeList1) {
+    if (!$input->IsArray()) {
+        SWIG_V8_Raise("Expected array as input");
+        SWIG_fail;
+    }
+    arr = v8::Local<v8::Array>::Cast($input);
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    try {
+        for (uint32_t i = 0; i < arr->Length(); i++) {
+            v8::Local<v8::Value> groupValue = arr->Get(context, i).ToLocalChecked();
+            if (!groupValue->IsArray()) {
+                SWIG_V8_Raise("Expected array as group");
+                SWIG_fail;
+            }
+            group = v8::Local<v8::Array>::Cast(groupValue);
+            for (uint32_t j = 0; j < group->Length(); j++) {
+                res = SWIG_ConvertPtr(group->Get(context, j).ToLocalChecked(), (void**)&vquery,
+                        $descriptor(griddb::Query*), 0);
+                if (!SWIG_IsOK(res)) {
+                    SWIG_V8_Raise("Convert pointer failed");
+                    SWIG_fail;
+                }
+                queryList1.push_back(vquery);
+            }
+            groupSizeList1.push_back(group->Length());
+        }
+    } catch (std::bad_alloc& ba) {
+        SWIG_V8_Raise("Memory allocation error");
+        SWIG_fail;
+    }
+    $1 = queryList1.empty() ? NULL : &queryList1[0];
+    $2 = groupSizeList1.empty() ? NULL : &groupSizeList1[0];
+    $3 = groupSizeList1.size();
+}
+
+%typemap(in, numinputs = 0) (std::vector<int>* groupOrderList, std::vector<griddb::RowSet*>* rowSetList)
+        (std::vector<int> groupOrderList1, std::vector<griddb::RowSet*> rowSetList1) {
+    $1 = &groupOrderList1;
+    $2 = &rowSetList1;
+}
+
+%typemap(argout) (std::vector<int>* groupOrderList, std::vector<griddb::RowSet*>* rowSetList)
+        (v8::Local<v8::Array> orderArr, v8::Local<v8::Array> rowSetArr, v8::Local<v8::Object> obj) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    orderArr = SWIGV8_ARRAY_NEW();
+    for (size_t i = 0; i < $1->size(); i++) {
+        orderArr->Set(context, i, SWIGV8_INTEGER_NEW((*$1)[i]));
+    }
+    //RowSets are owned by JavaScript objects from here
+    rowSetArr = SWIGV8_ARRAY_NEW();
+    for (size_t i = 0; i < $2->size(); i++) {
+        rowSetArr->Set(context, i, SWIG_NewPointerObj((void*) (*$2)[i], $descriptor(griddb::RowSet*), SWIG_POINTER_OWN));
+    }
+    obj = SWIGV8_OBJECT_NEW();
+    obj->Set(context, SWIGV8_STRING_NEW("groupOrder"), orderArr);
+    obj->Set(context, SWIGV8_STRING_NEW("rowSets"), rowSetArr);
+    $result = obj;
+}
+
 /**
 * Typemaps output for partition controller function
 */
@@ -1135,7 +1340,7 @@ static void freeargGetStore(const char* host, const char* cluster_name,
         SWIG_V8_Raise("Num row is different with container info");
         SWIG_fail;
     }
-    GSType* typeList = arg1->getGSTypeList();
+    const GSType* typeList = arg1->getGSTypeList();
     v8::Local<v8::Context> context = Nan::GetCurrentContext();
     for (int i = 0; i < leng; i++) {
         GSType type = typeList[i];
@@ -1157,7 +1362,7 @@ static void freeargGetStore(const char* host, const char* cluster_name,
     if ($input->IsNull() || $input->IsUndefined()) {
         $1->type = GS_TYPE_NULL;
     } else {
-        GSType* typeList = arg1->getGSTypeList();
+        const GSType* typeList = arg1->getGSTypeList();
         GSType type = typeList[0];
         if (!convertToRowKeyFieldWithType(*$1, $input, type)) {
             SWIG_V8_Raise("Can not convert to row field");
@@ -1170,11 +1375,31 @@ static void freeargGetStore(const char* host, const char* cluster_name,
     $1 = NULL;
 }
 
+/*
+* typemap for Container::multi_remove()
+*/
+%typemap(in, fragment = "convertToRowKeyFieldList") (griddb::Field* keyList, size_t keyCount)
+        (const char* errorMsg = NULL) {
+    const GSType* typeList = arg1->getGSTypeList();
+    if (!convertToRowKeyFieldList($input, typeList[0], &$1, &$2, &errorMsg)) {
+        delete[] $1;
+        $1 = NULL;
+        SWIG_V8_Raise(errorMsg);
+        SWIG_fail;
+    }
+}
+
+%typemap(freearg) (griddb::Field* keyList, size_t keyCount) {
+    if ($1) {
+        delete[] $1;
+    }
+}
+
 /**
  * Support convert data from GSRow* row to javascript data
  */
 %fragment("getRowFields", "header", fragment = "convertTimestampToObject") {
-static bool getRowFields(GSRow* row, int columnCount, GSType* typeList, bool timestampOutput, int* columnError, 
+static bool getRowFields(GSRow* row, int columnCount, const GSType* typeList, bool timestampOutput, int* columnError, 
         GSType* fieldTypeError, v8::Local<v8::Array> outList) {
     GSResult ret;
     GSValue mValue;
@@ -1221,6 +1446,17 @@ static bool getRowFields(GSRow* row, int columnCount, GSType* typeList, bool tim
                 if (!GS_SUCCEEDED(ret)) {
                     break;
                 }
+                //Value compressed on client side has header, others are returned as is
+                std::vector<char> decoded;
+                try {
+                    if (griddb::BlobCodec::decode(blobValue.data, blobValue.size, &decoded)) {
+                        blobValue.data = decoded.empty() ? NULL : &decoded[0];
+                        blobValue.size = decoded.size();
+                    }
+                } catch (std::bad_alloc& ba) {
+                    ret = -1;
+                    break;
+                }
                 outList->Set(context, i, Nan::CopyBuffer((char *)blobValue.data,
                     blobValue.size).ToLocalChecked());
                 break;
@@ -1444,6 +1680,210 @@ static bool getRowFields(GSRow* row, int columnCount, GSType* typeList, bool tim
 }
 }
 
+/**
+ * Support create Float64Array from list of double
+ */
+%fragment("convertDoubleListToFloat64Array", "header") {
+static v8::Local<v8::Float64Array> convertDoubleListToFloat64Array(const double* list, size_t size) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, size * sizeof(double));
+    if (size > 0) {
+%#if (V8_MAJOR_VERSION-0) >= 8
+        memcpy(buffer->GetBackingStore()->Data(), list, size * sizeof(double));
+%#else
+        memcpy(buffer->GetContents().Data(), list, size * sizeof(double));
+%#endif
+    }
+    return v8::Float64Array::New(buffer, 0, size);
+}
+}
+
+/**
+ * Support convert data from RowBatch to javascript object {rowCount, types, columns}.
+ * Fixed-width numeric and TIMESTAMP columns are Float64Array (epoch milliseconds for TIMESTAMP, NaN for NULL)
+ */
+%fragment("convertRowBatchToObject", "header", fragment = "convertDoubleListToFloat64Array") {
+static v8::Local<v8::Object> convertRowBatchToObject(griddb::RowBatch* batch) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    int32_t rowCount = batch->get_row_count();
+    int columnCount = batch->get_column_count();
+    v8::Local<v8::Array> columns = SWIGV8_ARRAY_NEW();
+    v8::Local<v8::Array> types = SWIGV8_ARRAY_NEW();
+
+    for (int i = 0; i < columnCount; i++) {
+        GSType type = batch->get_column_type(i);
+        types->Set(context, i, SWIGV8_INT32_NEW(type));
+        const double* numberList = batch->get_number_column(i);
+        if (type != GS_TYPE_BOOL && griddb::RowBatch::is_number_type(type)) {
+            columns->Set(context, i, convertDoubleListToFloat64Array(numberList, rowCount));
+            continue;
+        }
+
+        v8::Local<v8::Array> list = SWIGV8_ARRAY_NEW();
+        for (int32_t j = 0; j < rowCount; j++) {
+            if (batch->is_null(i, j)) {
+                list->Set(context, j, SWIGV8_NULL());
+            } else if (type == GS_TYPE_BOOL) {
+                list->Set(context, j, SWIGV8_BOOLEAN_NEW(numberList[j] != 0));
+            } else {
+                size_t size;
+                const GSChar* value = batch->get_value(i, j, &size);
+                if (type == GS_TYPE_BLOB) {
+                    list->Set(context, j, Nan::CopyBuffer(value, size).ToLocalChecked());
+                } else {
+                    list->Set(context, j, SWIGV8_STRING_NEW2(value, size));
+                }
+            }
+        }
+        columns->Set(context, i, list);
+    }
+
+    v8::Local<v8::Object> obj = SWIGV8_OBJECT_NEW();
+    obj->Set(context, SWIGV8_STRING_NEW("rowCount"), SWIGV8_INT32_NEW(rowCount));
+    obj->Set(context, SWIGV8_STRING_NEW("types"), types);
+    obj->Set(context, SWIGV8_STRING_NEW("columns"), columns);
+    return obj;
+}
+}
+
+/**
+ * Support create SharedArrayBuffer, *data is set to its memory
+ */
+%fragment("createSharedArrayBuffer", "header") {
+static v8::Local<v8::SharedArrayBuffer> createSharedArrayBuffer(size_t byteLength, void** data) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Local<v8::SharedArrayBuffer> buffer = v8::SharedArrayBuffer::New(isolate, byteLength);
+%#if (V8_MAJOR_VERSION-0) >= 8
+    *data = buffer->GetBackingStore()->Data();
+%#else
+    *data = buffer->GetContents().Data();
+%#endif
+    return buffer;
+}
+}
+
+/**
+ * Support convert data from RowBatch to javascript object {rowCount, schema, columns} backed by SharedArrayBuffer.
+ * Fixed-width column is {values: Float64Array} (NaN for NULL),
+ * STRING, GEOMETRY and BLOB column is {heap: Uint8Array, offsets: Uint32Array, nulls: Uint8Array}
+ */
+%fragment("convertRowBatchToSharedObject", "header", fragment = "createSharedArrayBuffer") {
+static bool convertRowBatchToSharedObject(griddb::RowBatch* batch, GSColumnInfo* columnInfoList,
+        v8::Local<v8::Object>* result) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    int32_t rowCount = batch->get_row_count();
+    int columnCount = batch->get_column_count();
+    v8::Local<v8::Array> schema = SWIGV8_ARRAY_NEW();
+    v8::Local<v8::Array> columns = SWIGV8_ARRAY_NEW();
+    void* data;
+
+    for (int i = 0; i < columnCount; i++) {
+        GSType type = batch->get_column_type(i);
+        v8::Local<v8::Object> columnSchema = SWIGV8_OBJECT_NEW();
+        columnSchema->Set(context, SWIGV8_STRING_NEW("name"),
+                SWIGV8_STRING_NEW(columnInfoList[i].name ? columnInfoList[i].name : ""));
+        columnSchema->Set(context, SWIGV8_STRING_NEW("type"), SWIGV8_INT32_NEW(type));
+        schema->Set(context, i, columnSchema);
+
+        v8::Local<v8::Object> column = SWIGV8_OBJECT_NEW();
+        if (griddb::RowBatch::is_number_type(type)) {
+            v8::Local<v8::SharedArrayBuffer> values = createSharedArrayBuffer(rowCount * sizeof(double), &data);
+            if (rowCount > 0) {
+                memcpy(data, batch->get_number_column(i), rowCount * sizeof(double));
+            }
+            column->Set(context, SWIGV8_STRING_NEW("values"), v8::Float64Array::New(values, 0, rowCount));
+        } else {
+            size_t heapSize;
+            const GSChar* heap = batch->get_heap(i, &heapSize);
+            if (heapSize > std::numeric_limits<uint32_t>::max()) {
+                return false;
+            }
+            v8::Local<v8::SharedArrayBuffer> heapBuffer = createSharedArrayBuffer(heapSize, &data);
+            if (heapSize > 0) {
+                memcpy(data, heap, heapSize);
+            }
+            column->Set(context, SWIGV8_STRING_NEW("heap"), v8::Uint8Array::New(heapBuffer, 0, heapSize));
+
+            const size_t* offsetList = batch->get_offset_list(i);
+            v8::Local<v8::SharedArrayBuffer> offsets = createSharedArrayBuffer((rowCount + 1) * sizeof(uint32_t), &data);
+            uint32_t* offsetData = (uint32_t*) data;
+            for (int32_t j = 0; j <= rowCount; j++) {
+                offsetData[j] = (uint32_t) offsetList[j];
+            }
+            v8::Local<v8::SharedArrayBuffer> nulls = createSharedArrayBuffer(rowCount, &data);
+            uint8_t* nullData = (uint8_t*) data;
+            for (int32_t j = 0; j < rowCount; j++) {
+                nullData[j] = batch->is_null(i, j) ? 1 : 0;
+            }
+            column->Set(context, SWIGV8_STRING_NEW("nulls"), v8::Uint8Array::New(nulls, 0, rowCount));
+            column->Set(context, SWIGV8_STRING_NEW("offsets"), v8::Uint32Array::New(offsets, 0, rowCount + 1));
+        }
+        columns->Set(context, i, column);
+    }
+
+    *result = SWIGV8_OBJECT_NEW();
+    (*result)->Set(context, SWIGV8_STRING_NEW("rowCount"), SWIGV8_INT32_NEW(rowCount));
+    (*result)->Set(context, SWIGV8_STRING_NEW("schema"), schema);
+    (*result)->Set(context, SWIGV8_STRING_NEW("columns"), columns);
+    return true;
+}
+}
+
+/**
+ * Typemap for RowSet::fetch_shared()
+ */
+%typemap(in, numinputs = 0) (griddb::RowBatch** sharedBatch) (griddb::RowBatch* sharedBatchTmp = NULL) {
+    $1 = &sharedBatchTmp;
+}
+
+%typemap(argout, fragment = "convertRowBatchToSharedObject") (griddb::RowBatch** sharedBatch) (v8::Local<v8::Object> obj) {
+    bool retVal = convertRowBatchToSharedObject(sharedBatchTmp$argnum, arg1->getColumnInfoList(), &obj);
+    delete sharedBatchTmp$argnum;
+    sharedBatchTmp$argnum = NULL;
+    if (!retVal) {
+        SWIG_V8_Raise("String heap is too large for SharedArrayBuffer");
+        SWIG_fail;
+    }
+    $result = obj;
+}
+
+/**
+ * Typemap for RowSet::fetch_columns()
+ */
+%typemap(out, fragment = "convertRowBatchToObject") griddb::RowBatch* {
+    $result = convertRowBatchToObject($1);
+    delete $1;
+}
+
+/**
+ * Typemap for BlobWriter::append(): input is Buffer, data is not copied here
+ */
+%typemap(in) (const GSChar* chunk, size_t chunkSize) {
+    if (!node::Buffer::HasInstance($input)) {
+        SWIG_V8_Raise("Expected Buffer as input");
+        SWIG_fail;
+    }
+    $1 = (const GSChar*) node::Buffer::Data($input);
+    $2 = node::Buffer::Length($input);
+}
+
+/**
+ * Typemap for BlobReader::read(): output is Buffer, or null if all data has been read
+ */
+%typemap(in, numinputs = 0) (const GSChar** chunk, size_t* chunkSize)
+        (const GSChar* chunkTmp, size_t chunkSizeTmp) {
+    $1 = &chunkTmp;
+    $2 = &chunkSizeTmp;
+}
+
+%typemap(argout) (const GSChar** chunk, size_t* chunkSize) {
+    if (chunkSizeTmp$argnum == 0) {
+        $result = SWIGV8_NULL();
+    } else {
+        $result = Nan::CopyBuffer(chunkTmp$argnum, chunkSizeTmp$argnum).ToLocalChecked();
+    }
+}
+
 /*
 * This typemap argument out does not get data from argument "GSRow *rowdata"
 * The argument "GSRow *rowdata" is not used in the function Container::get(), it only for the purpose of typemap matching pattern
@@ -1469,10 +1909,68 @@ static bool getRowFields(GSRow* row, int columnCount, GSType* typeList, bool tim
     }
 }
 
+/**
+ * Typemaps output for Container.get_many(): array of rows which exist
+ */
+%typemap(in, numinputs = 0) (GSRow* const** rowList, size_t* rowCount)
+        (GSRow* const* rowList1 = NULL, size_t rowCount1 = 0) {
+    $1 = &rowList1;
+    $2 = &rowCount1;
+}
+
+%typemap(argout, fragment = "getRowFields") (GSRow* const** rowList, size_t* rowCount) (v8::Local<v8::Array> list) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    list = SWIGV8_ARRAY_NEW();
+    int errorColumn;
+    GSType errorType;
+    for (size_t i = 0; i < rowCount1$argnum; i++) {
+        v8::Local<v8::Array> rowArr = SWIGV8_ARRAY_NEW();
+        if (!getRowFields(rowList1$argnum[i], arg1->getColumnCount(), arg1->getGSTypeList(),
+                arg1->timestamp_output_with_float, &errorColumn, &errorType, rowArr)) {
+            char errorMsg[60];
+            sprintf(errorMsg, "Can't get data for field %d with type %d", errorColumn, errorType);
+            SWIG_V8_Raise(errorMsg);
+            SWIG_fail;
+        }
+        list->Set(context, i, rowArr);
+    }
+    $result = list;
+}
+
+/**
+ * Typemaps output for Container.get_many_aligned(): array of row of each row key, null if it does not exist
+ */
+%typemap(in, numinputs = 0) (std::vector<GSRow*>* alignedRowList) (std::vector<GSRow*> alignedRowList1) {
+    $1 = &alignedRowList1;
+}
+
+%typemap(argout, fragment = "getRowFields") (std::vector<GSRow*>* alignedRowList) (v8::Local<v8::Array> list) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    list = SWIGV8_ARRAY_NEW();
+    int errorColumn;
+    GSType errorType;
+    for (size_t i = 0; i < $1->size(); i++) {
+        if ((*$1)[i] == NULL) {
+            list->Set(context, i, SWIGV8_NULL());
+            continue;
+        }
+        v8::Local<v8::Array> rowArr = SWIGV8_ARRAY_NEW();
+        if (!getRowFields((*$1)[i], arg1->getColumnCount(), arg1->getGSTypeList(),
+                arg1->timestamp_output_with_float, &errorColumn, &errorType, rowArr)) {
+            char errorMsg[60];
+            sprintf(errorMsg, "Can't get data for field %d with type %d", errorColumn, errorType);
+            SWIG_V8_Raise(errorMsg);
+            SWIG_fail;
+        }
+        list->Set(context, i, rowArr);
+    }
+    $result = list;
+}
+
 /**
  * Typemaps for Store.multi_put
  */
-%typemap(in, fragment = "convertToRowKeyFieldWithType", fragment = "SWIG_AsCharPtrAndSize", fragment = "cleanString"
+%typemap(in, fragment = "convertToStoreMultiPutRowList", fragment = "SWIG_AsCharPtrAndSize", fragment = "cleanString"
         , fragment = "freeargStoreMultiPut") (GSRow*** listRow, const int *listRowContainerCount, const char ** listContainerName, size_t containerCount)
 (v8::Local<v8::Object> obj, v8::Local<v8::Array> keys, v8::Local<v8::Array> arr, int res = 0, v8::Local<v8::Array> rowArr,
 size_t sizeTmp = 0, int* alloc = 0, char* v = 0) {
@@ -1488,7 +1986,6 @@ size_t sizeTmp = 0, int* alloc = 0, char* v = 0) {
     obj = $input->ToObject(context).ToLocalChecked();
     keys = obj->GetOwnPropertyNames(context).ToLocalChecked();
     $4 = (size_t) keys->Length();
-    griddb::Container* tmpContainer;
 
     if ($4 > 0) {
         try {
@@ -1533,92 +2030,321 @@ size_t sizeTmp = 0, int* alloc = 0, char* v = 0) {
                 SWIG_V8_Raise("Memory allocation error");
                 SWIG_fail;
             }
-            //Get container info
-            griddb::ContainerInfo* containerInfoTmp = NULL;
-            try {
-                containerInfoTmp = arg1->get_container_info($3[i]);
-            } catch (griddb::GSException& e) {
+            //Get container info, it is served by schema cache of Store if enabled.
+            //Cached schema may be out of date, so get it from server and retry once if conversion fails.
+            bool retried = false;
+            while (true) {
+                griddb::ContainerInfo* containerInfoTmp = NULL;
+                try {
+                    containerInfoTmp = arg1->get_container_info($3[i]);
+                } catch (griddb::GSException& e) {
+                    freeargStoreMultiPut($1, $2, $3, $4, alloc);
+                    string innerErrMsg((&e)->what());
+                    string errMessage = "Get container info for Multiput Error: " + innerErrMsg;
+                    SWIG_V8_Raise(errMessage.c_str());
+                    SWIG_fail;
+                }
+                if (containerInfoTmp == NULL) {
+                    freeargStoreMultiPut($1, $2, $3, $4, alloc);
+                    SWIG_V8_Raise("Can not get Container info");
+                    SWIG_fail;
+                }
+                //Shared schema is used to avoid copying container information
+                griddb::ContainerSchemaPtr schema = containerInfoTmp->get_schema();
+                delete containerInfoTmp;
+                char errorMsg[100];
+                int errorColumn = -1;
+                bool converted = convertToStoreMultiPutRowList(arg1->getGSStorePtr(),
+                        schema->gs_info(), arr, $1[i], errorMsg, &errorColumn);
+                if (converted) {
+                    break;
+                }
+                if (errorColumn >= 0 && !retried && arg1->get_schema_cache_ttl() > 0) {
+                    for (int j = 0; j < $2[i]; j++) {
+                        gsCloseRow(&$1[i][j]);
+                    }
+                    arg1->invalidate_schema_cache($3[i]);
+                    retried = true;
+                    continue;
+                }
                 freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                string innerErrMsg((&e)->what());
-                string errMessage = "Get container info for Multiput Error: " + innerErrMsg;
-                SWIG_V8_Raise(errMessage.c_str());
+                SWIG_V8_Raise(errorMsg);
                 SWIG_fail;
             }
-            if (containerInfoTmp == NULL) {
-                freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                SWIG_V8_Raise("Can not get Container info");
+        }
+    }
+}
+
+%typemap(freearg, fragment = "freeargStoreMultiPut") (GSRow*** listRow, const int *listRowContainerCount, const char ** listContainerName, size_t containerCount) {
+    freeargStoreMultiPut($1, $2, $3, $4, alloc$argnum);
+}
+
+/**
+ * Typemaps for Store.multi_remove: object of container name and array or typed array of row keys
+ */
+%typemap(in, fragment = "convertToRowKeyFieldList", fragment = "SWIG_AsCharPtrAndSize", fragment = "cleanString",
+        fragment = "freeargStoreMultiRemove") (const char* const* nameList, griddb::Field* const* keyLists,
+        const size_t* keyCountList, size_t containerCount)
+        (v8::Local<v8::Object> obj, v8::Local<v8::Array> keys, int res = 0, size_t sizeTmp = 0, int alloc = 0,
+        char* v = 0, char** nameList1 = NULL, griddb::Field** keyLists1 = NULL, size_t* keyCountList1 = NULL) {
+    if (!$input->IsObject()) {
+        SWIG_V8_Raise("Expected object property as input");
+        SWIG_fail;
+    }
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    obj = $input->ToObject(context).ToLocalChecked();
+    keys = obj->GetOwnPropertyNames(context).ToLocalChecked();
+    $4 = (size_t) keys->Length();
+    try {
+        nameList1 = new char*[$4]();
+        keyLists1 = new griddb::Field*[$4]();
+        keyCountList1 = new size_t[$4]();
+    } catch (std::bad_alloc& ba) {
+        freeargStoreMultiRemove(nameList1, keyLists1, keyCountList1, $4);
+        SWIG_V8_Raise("Memory allocation error");
+        SWIG_fail;
+    }
+    $1 = nameList1;
+    $2 = keyLists1;
+    $3 = keyCountList1;
+
+    for (size_t i = 0; i < $4; i++) {
+        v8::Local<v8::Value> key = keys->Get(context, i).ToLocalChecked();
+        res = SWIG_AsCharPtrAndSize(key, &v, &sizeTmp, &alloc);
+        if (!SWIG_IsOK(res)) {
+            freeargStoreMultiRemove(nameList1, keyLists1, keyCountList1, $4);
+            %variable_fail(res, "String", "containerName");
+        }
+        griddb::Util::strdup((const GSChar**) &nameList1[i], v);
+        cleanString(v, alloc);
+
+        //Row key type is served by schema cache of Store if enabled
+        griddb::ContainerInfo* containerInfoTmp = NULL;
+        try {
+            containerInfoTmp = arg1->get_container_info(nameList1[i]);
+        } catch (griddb::GSException& e) {
+            freeargStoreMultiRemove(nameList1, keyLists1, keyCountList1, $4);
+            string innerErrMsg((&e)->what());
+            string errMessage = "Get container info for multiRemove Error: " + innerErrMsg;
+            SWIG_V8_Raise(errMessage.c_str());
+            SWIG_fail;
+        }
+        if (containerInfoTmp == NULL) {
+            freeargStoreMultiRemove(nameList1, keyLists1, keyCountList1, $4);
+            SWIG_V8_Raise("Can not get Container info");
+            SWIG_fail;
+        }
+        griddb::ContainerSchemaPtr schema = containerInfoTmp->get_schema();
+        delete containerInfoTmp;
+        const char* errorMsg = NULL;
+        v8::Local<v8::Value> value = obj->Get(context, key).ToLocalChecked();
+        if (!convertToRowKeyFieldList(value, schema->get_type_list()[0], &keyLists1[i],
+                &keyCountList1[i], &errorMsg)) {
+            freeargStoreMultiRemove(nameList1, keyLists1, keyCountList1, $4);
+            SWIG_V8_Raise(errorMsg);
+            SWIG_fail;
+        }
+    }
+}
+
+%typemap(freearg, fragment = "freeargStoreMultiRemove") (const char* const* nameList, griddb::Field* const* keyLists,
+        const size_t* keyCountList, size_t containerCount) {
+    freeargStoreMultiRemove(nameList1$argnum, keyLists1$argnum, keyCountList1$argnum, $4);
+}
+
+%fragment("freeargStoreMultiRemove", "header") {
+static void freeargStoreMultiRemove(char** nameList, griddb::Field** keyLists, size_t* keyCountList,
+        size_t containerCount) {
+    for (size_t i = 0; i < containerCount; i++) {
+        if (nameList && nameList[i]) {
+            delete[] nameList[i];
+        }
+        if (keyLists && keyLists[i]) {
+            delete[] keyLists[i];
+        }
+    }
+    if (nameList) {
+        delete[] nameList;
+    }
+    if (keyLists) {
+        delete[] keyLists;
+    }
+    if (keyCountList) {
+        delete[] keyCountList;
+    }
+}
+}
+
+/**
+ * Typemaps for Store.put_containers: array of ContainerInfo
+ */
+%typemap(in) (griddb::ContainerInfo* const* infoList, size_t infoCount)
+        (v8::Local<v8::Array> arr, griddb::ContainerInfo* vinfo, int res = 0) {
+    if (!$input->IsArray()) {
+        SWIG_V8_Raise("Expected array as input");
+        SWIG_fail;
+    }
+    arr = v8::Local<v8::Array>::Cast($input);
+    $2 = (size_t) arr->Length();
+    $1 = NULL;
+    if ($2 > 0) {
+        try {
+            $1 = new griddb::ContainerInfo*[$2]();
+        } catch (std::bad_alloc& ba) {
+            SWIG_V8_Raise("Memory allocation error");
+            SWIG_fail;
+        }
+        v8::Local<v8::Context> context = Nan::GetCurrentContext();
+        for (size_t i = 0; i < $2; i++) {
+            res = SWIG_ConvertPtr(arr->Get(context, i).ToLocalChecked(), (void**)&vinfo,
+                    $descriptor(griddb::ContainerInfo*), 0);
+            if (!SWIG_IsOK(res)) {
+                delete[] $1;
+                SWIG_V8_Raise("Convert pointer failed");
                 SWIG_fail;
             }
-            ColumnInfoList infoListTmp = containerInfoTmp->get_column_info_list();
-            int* typeArr;
-            try {
-                typeArr = new int[infoListTmp.size]();
-            } catch (std::bad_alloc& ba) {
-                freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                delete containerInfoTmp;
-                SWIG_V8_Raise("Memory allocation error");
+            $1[i] = vinfo;
+        }
+    }
+}
+
+%typemap(freearg) (griddb::ContainerInfo* const* infoList, size_t infoCount) {
+    if ($1) {
+        delete[] $1;
+    }
+}
+
+/**
+ * Typemaps for Store.put_containers: array of index information ({"columnName" : str, "indexType" : int, "name" : str})
+ */
+%typemap(in, fragment = "SWIG_AsCharPtrAndSize", fragment = "cleanString", fragment = "freeargIndexInfoList")
+        (const GSIndexInfo* indexList, size_t indexCount)
+        (v8::Local<v8::Array> arr, int res = 0, size_t sizeTmp = 0, int alloc = 0, char* v = 0,
+        GSIndexInfo* indexList1 = NULL) {
+    if ($input->IsNull() || $input->IsUndefined()) {
+        $1 = NULL;
+        $2 = 0;
+    } else if (!$input->IsArray()) {
+        SWIG_V8_Raise("Expected array as input");
+        SWIG_fail;
+    } else {
+        arr = v8::Local<v8::Array>::Cast($input);
+        $2 = (size_t) arr->Length();
+        try {
+            indexList1 = new GSIndexInfo[$2];
+        } catch (std::bad_alloc& ba) {
+            SWIG_V8_Raise("Memory allocation error");
+            SWIG_fail;
+        }
+        GSIndexInfo indexInfoInitializer = GS_INDEX_INFO_INITIALIZER;
+        for (size_t i = 0; i < $2; i++) {
+            indexList1[i] = indexInfoInitializer;
+        }
+        $1 = indexList1;
+        v8::Local<v8::Context> context = Nan::GetCurrentContext();
+        for (size_t i = 0; i < $2; i++) {
+            v8::Local<v8::Value> item = arr->Get(context, i).ToLocalChecked();
+            if (!item->IsObject()) {
+                freeargIndexInfoList(indexList1, $2);
+                SWIG_V8_Raise("Expected object property as index information");
                 SWIG_fail;
             }
-            for (int m = 0; m < infoListTmp.size; m++) {
-                typeArr[m] = infoListTmp.columnInfo[m].type;
-            }
-            try {
-                tmpContainer = arg1->get_container($3[i]);
-            } catch (griddb::GSException& e) {
-                freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                delete containerInfoTmp;
-                string innerErrMsg((&e)->what());
-                string errMessage = "Get container for Multiput Error: " + innerErrMsg;
-                SWIG_V8_Raise(errMessage.c_str());
+            v8::Local<v8::Object> obj = item->ToObject(context).ToLocalChecked();
+            v8::Local<v8::Value> columnName = obj->Get(context, SWIGV8_STRING_NEW("columnName")).ToLocalChecked();
+            v8::Local<v8::Value> indexType = obj->Get(context, SWIGV8_STRING_NEW("indexType")).ToLocalChecked();
+            v8::Local<v8::Value> name = obj->Get(context, SWIGV8_STRING_NEW("name")).ToLocalChecked();
+            if (!columnName->IsString() || !(indexType->IsUndefined() || indexType->IsInt32()) ||
+                    !(name->IsUndefined() || name->IsNull() || name->IsString())) {
+                freeargIndexInfoList(indexList1, $2);
+                SWIG_V8_Raise("Invalid value for index information");
                 SWIG_fail;
             }
-            if (tmpContainer == NULL) {
-                delete containerInfoTmp;
-                delete[] typeArr;
-                freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                SWIG_V8_Raise("Expect row is array");
-                SWIG_fail;
+            res = SWIG_AsCharPtrAndSize(columnName, &v, &sizeTmp, &alloc);
+            if (!SWIG_IsOK(res)) {
+                freeargIndexInfoList(indexList1, $2);
+                %variable_fail(res, "String", "columnName");
             }
-            GSResult ret;
-            for (int j = 0; j < $2[i]; j++) {
-                ret = gsCreateRowByContainer(tmpContainer->getGSContainerPtr(), &$1[i][j]);
-                v8::Local<v8::Value> rowArrValue =
-                    arr->Get(context, j).ToLocalChecked();
-                rowArr = v8::Local<v8::Array>::Cast(rowArrValue);
-                if (!rowArr->IsArray()) {
-                    delete containerInfoTmp;
-                    delete[] typeArr;
-                    delete tmpContainer;
-                    freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                    SWIG_V8_Raise("Expect row is array");
-                    SWIG_fail;
-                }
-                int rowLen = (int) rowArr->Length();
-                int k;
-                for (k = 0; k < rowLen; k++) {
-                    v8::Local<v8::Value> rowValue =
-                        rowArr->Get(context, k).ToLocalChecked();
-                    if (!(convertToFieldWithType($1[i][j], k, rowValue, typeArr[k]))) {
-                        char errorMsg[60];
-                        sprintf(errorMsg, "Invalid value for column %d, type should be : %d", k, typeArr[k]);
-                        delete tmpContainer;
-                        delete containerInfoTmp;
-                        delete[] typeArr;
-                        freeargStoreMultiPut($1, $2, $3, $4, alloc);
-                        SWIG_V8_Raise(errorMsg);
-                        SWIG_fail;
-                    }
+            griddb::Util::strdup(&indexList1[i].columnName, v);
+            cleanString(v, alloc);
+            if (name->IsString()) {
+                res = SWIG_AsCharPtrAndSize(name, &v, &sizeTmp, &alloc);
+                if (!SWIG_IsOK(res)) {
+                    freeargIndexInfoList(indexList1, $2);
+                    %variable_fail(res, "String", "name");
                 }
+                griddb::Util::strdup(&indexList1[i].name, v);
+                cleanString(v, alloc);
+            }
+            if (indexType->IsInt32()) {
+                indexList1[i].type = indexType->Int32Value(context).FromJust();
             }
-            delete tmpContainer;
-            delete[] typeArr;
-            delete containerInfoTmp;
         }
     }
 }
 
-%typemap(freearg, fragment = "freeargStoreMultiPut") (GSRow*** listRow, const int *listRowContainerCount, const char ** listContainerName, size_t containerCount) {
-    freeargStoreMultiPut($1, $2, $3, $4, alloc$argnum);
+%typemap(freearg, fragment = "freeargIndexInfoList") (const GSIndexInfo* indexList, size_t indexCount) {
+    freeargIndexInfoList(indexList1$argnum, $2);
+}
+
+%fragment("freeargIndexInfoList", "header") {
+static void freeargIndexInfoList(GSIndexInfo* indexList, size_t indexCount) {
+    if (!indexList) {
+        return;
+    }
+    for (size_t i = 0; i < indexCount; i++) {
+        if (indexList[i].columnName) {
+            delete[] indexList[i].columnName;
+        }
+        if (indexList[i].name) {
+            delete[] indexList[i].name;
+        }
+    }
+    delete[] indexList;
+}
+}
+
+%fragment("convertToStoreMultiPutRowList", "header", fragment = "convertToFieldWithType") {
+/**
+ * Create rows of a container for Store.multi_put from array of rows.
+ * Return false if failed, errorColumn is set when a value can not be converted to the column type.
+ * Rows created before failure are kept in rowList.
+ */
+static bool convertToStoreMultiPutRowList(GSGridStore* store, const GSContainerInfo* containerInfo,
+        v8::Local<v8::Array> arr, GSRow** rowList, char* errorMsg, int* errorColumn) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    int rowCount = (int) arr->Length();
+    int columnCount = (int) containerInfo->columnCount;
+    *errorColumn = -1;
+    for (int j = 0; j < rowCount; j++) {
+        v8::Local<v8::Value> rowArrValue = arr->Get(context, j).ToLocalChecked();
+        if (!rowArrValue->IsArray()) {
+            sprintf(errorMsg, "Expect row is array");
+            return false;
+        }
+        GSResult ret = gsCreateRowByStore(store, containerInfo, &rowList[j]);
+        if (!GS_SUCCEEDED(ret)) {
+            sprintf(errorMsg, "Can not create row");
+            return false;
+        }
+        v8::Local<v8::Array> rowArr = v8::Local<v8::Array>::Cast(rowArrValue);
+        int rowLen = (int) rowArr->Length();
+        for (int k = 0; k < rowLen; k++) {
+            if (k >= columnCount) {
+                sprintf(errorMsg, "Invalid value for column %d, column does not exist", k);
+                *errorColumn = k;
+                return false;
+            }
+            GSType type = containerInfo->columnInfoList[k].type;
+            v8::Local<v8::Value> rowValue = rowArr->Get(context, k).ToLocalChecked();
+            if (!(convertToFieldWithType(rowList[j], k, rowValue, type))) {
+                sprintf(errorMsg, "Invalid value for column %d, type should be : %d", k, type);
+                *errorColumn = k;
+                return false;
+            }
+        }
+    }
+    return true;
+}
 }
 
 %fragment("freeargStoreMultiPut", "header") {
@@ -1887,6 +2613,98 @@ static void freeargStoreMultiGet(const GSRowKeyPredicateEntry *const * predicate
 }
 
 
+/**
+ * Support convert value bound to parameter of PreparedQuery to Field.
+ * Type of Field is decided by type of value.
+ */
+%fragment("convertObjectToParameterField", "header", fragment = "SWIG_AsCharPtrAndSize",
+        fragment = "cleanString", fragment = "isInt64", fragment = "SWIG_AsVal_bool") {
+static bool convertObjectToParameterField(griddb::Field &field, v8::Local<v8::Value> value) {
+    if (value->IsNull() || value->IsUndefined()) {
+        field.type = GS_TYPE_NULL;
+    } else if (value->IsBoolean()) {
+        bool boolVal;
+        if (!SWIG_IsOK(SWIG_AsVal_bool(value, &boolVal))) {
+            return false;
+        }
+        field.type = GS_TYPE_BOOL;
+        field.value.asBool = boolVal ? GS_TRUE : GS_FALSE;
+    } else if (value->IsDate()) {
+        field.type = GS_TYPE_TIMESTAMP;
+        field.value.asTimestamp = (GSTimestamp) value->NumberValue(Nan::GetCurrentContext()).FromJust();
+    } else if (value->IsNumber()) {
+        double doubleVal = value->NumberValue(Nan::GetCurrentContext()).FromJust();
+        if (isInt64(doubleVal) && -9007199254740992.0 <= doubleVal && doubleVal <= 9007199254740992.0) {
+            field.type = GS_TYPE_LONG;
+            field.value.asLong = (int64_t) doubleVal;
+        } else {
+            field.type = GS_TYPE_DOUBLE;
+            field.value.asDouble = doubleVal;
+        }
+    } else if (value->IsString()) {
+        GSChar* stringVal;
+        size_t size;
+        int alloc;
+        int res = SWIG_AsCharPtrAndSize(value, &stringVal, &size, &alloc);
+        if (!SWIG_IsOK(res)) {
+            return false;
+        }
+        field.type = GS_TYPE_STRING;
+        try {
+            griddb::Util::strdup(&field.value.asString, stringVal);
+        } catch (std::bad_alloc& ba) {
+            field.value.asString = NULL;
+            cleanString(stringVal, alloc);
+            return false;
+        }
+        cleanString(stringVal, alloc);
+    } else {
+        return false;
+    }
+    return true;
+}
+}
+
+/**
+ * Typemap for PreparedQuery.execute
+ */
+%typemap(in, fragment = "convertObjectToParameterField") (griddb::Field* parameterList, int parameterCount) {
+    if (!$input->IsArray()) {
+        SWIG_V8_Raise("Expected array as input");
+        SWIG_fail;
+    }
+    v8::Local<v8::Array> arr = v8::Local<v8::Array>::Cast($input);
+    $2 = (int)arr->Length();
+    $1 = NULL;
+
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    if ($2 > 0) {
+        try {
+            $1 = new griddb::Field[$2]();
+        } catch (std::bad_alloc& ba) {
+            SWIG_V8_Raise("Memory allocation error");
+            SWIG_fail;
+        }
+        for (int i = 0; i < $2; i++) {
+            v8::Local<v8::Value> value = arr->Get(context, i).ToLocalChecked();
+            if (!(convertObjectToParameterField($1[i], value))) {
+                char errorMsg[60];
+                sprintf(errorMsg, "Invalid value for parameter %d", i + 1);
+                delete [] $1;
+                $1 = NULL;
+                SWIG_V8_Raise(errorMsg);
+                SWIG_fail;
+            }
+        }
+    }
+}
+
+%typemap(freearg) (griddb::Field* parameterList, int parameterCount) {
+    if ($1) {
+        delete [] $1;
+    }
+}
+
 /**
 * Typemaps output for RowKeyPredicate.get_distinct_keys
 */
@@ -1932,8 +2750,7 @@ static void freeargStoreMultiGet(const GSRowKeyPredicateEntry *const * predicate
     }
 
     if ($2 > 0) {
-        GSContainer *mContainer = arg1->getGSContainerPtr();
-        GSType* typeList = arg1->getGSTypeList();
+        const GSType* typeList = arg1->getGSTypeList();
         try {
             $1 = new GSRow*[$2]();
         } catch (std::bad_alloc& ba) {
@@ -1947,13 +2764,14 @@ static void freeargStoreMultiGet(const GSRowKeyPredicateEntry *const * predicate
             v8::Local<v8::Array> fieldArr = v8::Local<v8::Array>::Cast(fieldArrValue);
             length = (int)fieldArr->Length();
             if (length != arg1->getColumnCount()) {
-                freeargContainerMultiPut($1, i);
+                freeargContainerMultiPut(arg1, $1, i);
                 SWIG_V8_Raise("Num row is different with container info");
                 SWIG_fail;
             }
-            GSResult ret = gsCreateRowByContainer(mContainer, &$1[i]);
+            //Row is taken from pool of container if available
+            GSResult ret = arg1->acquireRow(&$1[i]);
             if (!GS_SUCCEEDED(ret)) {
-                freeargContainerMultiPut($1, i);
+                freeargContainerMultiPut(arg1, $1, i);
                 SWIG_V8_Raise("Can't create GSRow");
                 SWIG_fail;
             }
@@ -1964,7 +2782,7 @@ static void freeargStoreMultiGet(const GSRowKeyPredicateEntry *const * predicate
                 if (!(convertToFieldWithType($1[i], k, fieldValue, type))) {
                     char errorMsg[200];
                     sprintf(errorMsg, "Invalid value for row %d, column %d, type should be : %d", i, k, type);
-                    freeargContainerMultiPut($1, i + 1);
+                    freeargContainerMultiPut(arg1, $1, i + 1);
                     SWIG_V8_Raise(errorMsg);
                     SWIG_fail;
                 }
@@ -1974,18 +2792,14 @@ static void freeargStoreMultiGet(const GSRowKeyPredicateEntry *const * predicate
 }
 
 %typemap(freearg, fragment = "freeargContainerMultiPut") (GSRow** listRowdata, int rowCount) {
-    freeargContainerMultiPut($1, $2);
+    freeargContainerMultiPut(arg1, $1, $2);
 }
 
 %fragment("freeargContainerMultiPut", "header") {
     //SWIG does not include freearg in fail: label (not like Python, so we need this function)
-static void freeargContainerMultiPut(GSRow** listRowdata, int rowCount) {
-    if (listRowdata) {
-        for (int rowNum = 0; rowNum < rowCount; rowNum++) {
-            gsCloseRow(&listRowdata[rowNum]);
-        }
-        delete [] listRowdata;
-    }
+static void freeargContainerMultiPut(griddb::Container* container, GSRow** listRowdata, int rowCount) {
+    //Rows are returned to pool of container for next multi_put
+    container->releaseRowList(listRowdata, rowCount);
 }
 }
 
@@ -2578,6 +3392,63 @@ static void freeargContainerInfo(const GSChar* name, const GSColumnInfo* props,
     $1 = (boolVal == true) ? GS_TRUE : GS_FALSE;
 }
 
+/**
+ * Typemaps output for Store.list_container_names(): array of container name array of each partition
+ */
+%typemap(in, numinputs = 0) (std::vector<std::vector<std::string> >* partitionNameList)
+        (std::vector<std::vector<std::string> > partitionNameList1) {
+    $1 = &partitionNameList1;
+}
+
+%typemap(argout) (std::vector<std::vector<std::string> >* partitionNameList) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    v8::Local<v8::Array> list = SWIGV8_ARRAY_NEW();
+    for (size_t i = 0; i < $1->size(); i++) {
+        v8::Local<v8::Array> nameList = SWIGV8_ARRAY_NEW();
+        for (size_t j = 0; j < (*$1)[i].size(); j++) {
+            nameList->Set(context, j, SWIGV8_STRING_NEW((*$1)[i][j].c_str()));
+        }
+        list->Set(context, i, nameList);
+    }
+    $result = list;
+}
+
+/**
+ * Typemaps output for Store.multi_put_parallel(): array of error message of each container, null if succeeded
+ */
+%typemap(in, numinputs = 0) (std::vector<std::string>* errorList) (std::vector<std::string> errorList1) {
+    $1 = &errorList1;
+}
+
+%typemap(argout) (std::vector<std::string>* errorList) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    v8::Local<v8::Array> list = SWIGV8_ARRAY_NEW();
+    for (size_t i = 0; i < $1->size(); i++) {
+        if ((*$1)[i].empty()) {
+            list->Set(context, i, SWIGV8_NULL());
+        } else {
+            list->Set(context, i, SWIGV8_STRING_NEW((*$1)[i].c_str()));
+        }
+    }
+    $result = list;
+}
+
+/**
+ * Typemaps output for Store.get_container_counts(): array of number of containers of each partition
+ */
+%typemap(in, numinputs = 0) (std::vector<int64_t>* countList) (std::vector<int64_t> countList1) {
+    $1 = &countList1;
+}
+
+%typemap(argout) (std::vector<int64_t>* countList) {
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    v8::Local<v8::Array> list = SWIGV8_ARRAY_NEW();
+    for (size_t i = 0; i < $1->size(); i++) {
+        list->Set(context, i, SWIGV8_NUMBER_NEW((double) (*$1)[i]));
+    }
+    $result = list;
+}
+
 /*
  * Correct PartitionController.getContainerNames() function
  */